@@ -4,5 +4,7 @@
 #cmakedefine HAVE_STDIO_H
 #cmakedefine HAVE_STDLIB_H
 #cmakedefine HAVE_LIBC
+#cmakedefine HAVE_MEMFD_CREATE 1
+#cmakedefine HAVE_SCHED_YIELD 1
 #cmakedefine SIZEOF_INT @SIZEOF_INT@
 #cmakedefine01 fftw3f_FOUND
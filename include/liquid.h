@@ -440,6 +440,25 @@ CBUFFER() CBUFFER(_create)(unsigned int _max_size);                         \
 CBUFFER() CBUFFER(_create_max)(unsigned int _max_size,                      \
                                unsigned int _max_read);                     \
                                                                             \
+/* Create circular buffer object of a particular size backed by memory  */  \
+/* which is mapped twice back-to-back, so that any region of the buffer */  \
+/* is contiguous; read() never needs to linearize the buffer and the    */  \
+/* maximum read size is the buffer size. Falls back to the standard     */  \
+/* implementation when not supported by the platform.                   */  \
+/*  _max_size   : maximum buffer size, _max_size > 0                    */  \
+CBUFFER() CBUFFER(_create_mirror)(unsigned int _max_size);                  \
+                                                                            \
+/* Create circular buffer object for passing samples from exactly one   */  \
+/* producer thread to one consumer thread without locks. The producer   */  \
+/* may only call push(), write(), write_available(), write_wait(), and  */  \
+/* space_available(); the consumer may only call pop(), read(),         */  \
+/* read_wait(), release(), and size(). All other methods, including     */  \
+/* reset() and copy(), require both threads to be idle.                 */  \
+/*  _max_size  : maximum buffer size, _max_size > 0                     */  \
+/*  _max_read  : maximum size that will be read from buffer             */  \
+CBUFFER() CBUFFER(_create_spsc)(unsigned int _max_size,                     \
+                                unsigned int _max_read);                    \
+                                                                            \
 /* Copy object including all internal objects and state                 */  \
 CBUFFER() CBUFFER(_copy)(CBUFFER() _q);                                     \
                                                                             \
@@ -484,6 +503,27 @@ int CBUFFER(_write)(CBUFFER()    _q,                                        \
                     T *          _v,                                        \
                     unsigned int _n);                                       \
                                                                             \
+/* Write as many samples as there is space available in the buffer,     */  \
+/* never raising an error when the buffer fills                         */  \
+/*  _q          : circular buffer object                                */  \
+/*  _v          : input array, [size: _n x 1]                           */  \
+/*  _n          : number of samples requested to write                  */  \
+/*  _num_written: number of samples actually written                    */  \
+int CBUFFER(_write_available)(CBUFFER()      _q,                            \
+                              T *            _v,                            \
+                              unsigned int   _n,                            \
+                              unsigned int * _num_written);                 \
+                                                                            \
+/* Write samples to the buffer, waiting as long as necessary for the    */  \
+/* consumer to free space. Only available for buffers created with      */  \
+/* create_spsc().                                                       */  \
+/*  _q  : circular buffer object                                        */  \
+/*  _v  : input array, [size: _n x 1]                                   */  \
+/*  _n  : number of samples to write                                    */  \
+int CBUFFER(_write_wait)(CBUFFER()    _q,                                   \
+                         T *          _v,                                   \
+                         unsigned int _n);                                  \
+                                                                            \
 /* Remove and return a single element from the buffer by setting the    */  \
 /* value of the output sample pointed to by _v                          */  \
 /*  _q  : circular buffer object                                        */  \
@@ -503,6 +543,18 @@ int CBUFFER(_read)(CBUFFER()      _q,                                       \
                    T **           _v,                                       \
                    unsigned int * _num_read);                               \
                                                                             \
+/* Read buffer contents, waiting as long as necessary for the producer  */  \
+/* to write the requested number of elements (limited to the maximum    */  \
+/* read size). Only available for buffers created with create_spsc().   */  \
+/*  _q              : circular buffer object                            */  \
+/*  _num_requested  : number of elements requested                      */  \
+/*  _v              : output pointer                                    */  \
+/*  _num_read       : number of elements referenced by _v               */  \
+int CBUFFER(_read_wait)(CBUFFER()      _q,                                  \
+                        unsigned int   _num_requested,                      \
+                        T **           _v,                                  \
+                        unsigned int * _num_read);                          \
+                                                                            \
 /* Release _n samples from the buffer                                   */  \
 /*  _q : circular buffer object                                         */  \
 /*  _n : number of elements to release                                  */  \
@@ -532,6 +584,22 @@ typedef struct WINDOW(_s) * WINDOW();                                       \
 /*  _n      : length of the window buffer [samples]                     */  \
 WINDOW() WINDOW(_create)(unsigned int _n);                                  \
                                                                             \
+/* Create window buffer object of a fixed length with extra memory      */  \
+/* allocated so that the internal array only needs to be compacted      */  \
+/* once every _slack samples. Larger values trade memory for fewer      */  \
+/* copies; create() uses the smallest power of two greater than _n.     */  \
+/*  _n      : length of the window buffer [samples]                     */  \
+/*  _slack  : number of samples written between compactions, _slack > 0 */  \
+WINDOW() WINDOW(_create_slack)(unsigned int _n,                             \
+                               unsigned int _slack);                        \
+                                                                            \
+/* Create window buffer object of a fixed length backed by memory which */  \
+/* is mapped twice back-to-back, so that the window is contiguous at    */  \
+/* any position and never needs to be compacted. Falls back to the      */  \
+/* standard implementation when not supported by the platform.          */  \
+/*  _n      : length of the window buffer [samples]                     */  \
+WINDOW() WINDOW(_create_mirror)(unsigned int _n);                           \
+                                                                            \
 /* Recreate window buffer object with new length.                       */  \
 /* This extends an existing window's size, similar to the standard C    */  \
 /* library's realloc() to n samples.                                    */  \
@@ -583,6 +651,10 @@ int WINDOW(_index)(WINDOW()     _q,                                         \
                    unsigned int _i,                                         \
                    T *          _v);                                        \
                                                                             \
+/* Get number of samples which may be written between compactions;      */  \
+/* returns zero for mirrored windows which are never compacted          */  \
+unsigned int WINDOW(_get_slack)(WINDOW() _q);                               \
+                                                                            \
 /* Shifts a single sample into the right side of the window, pushing    */  \
 /* the oldest (left-most) sample out of the end. Unlike stacks, the     */  \
 /* window object has no equivalent "pop" method, as values are retained */  \
@@ -594,7 +666,8 @@ int WINDOW(_push)(WINDOW() _q,                                              \
                                                                             \
 /* Write array of elements onto window buffer                           */  \
 /* Effectively, this is equivalent to pushing each sample one at a      */  \
-/* time, but executes much faster.                                      */  \
+/* time, but executes much faster: the block is copied at once and the  */  \
+/* internal memory is compacted at most once.                           */  \
 /*  _q      : window object                                             */  \
 /*  _v      : input array of values to write                            */  \
 /*  _n      : number of input values to write                           */  \
@@ -670,6 +743,9 @@ LIQUID_WDELAY_DEFINE_API(LIQUID_WDELAY_MANGLE_CFLOAT, liquid_float_complex)
 // MODULE : channel
 //
 
+// random number generator object (see random module)
+typedef struct liquid_rng_s * liquid_rng;
+
 #define LIQUID_CHANNEL_MANGLE_CCCF(name) LIQUID_CONCAT(channel_cccf,name)
 
 // large macro
@@ -726,6 +802,15 @@ int CHANNEL(_add_shadowing)(CHANNEL()    _q,                                \
                             float        _sigma,                            \
                             float        _fd);                              \
                                                                             \
+/* Set random number generator used for noise and shadowing. The        */  \
+/* object keeps its own copy of _rng so that a counter-based generator  */  \
+/* with a given (seed, stream, offset) reproduces the same impairments  */  \
+/* regardless of other draws; NULL reverts to the global rand() state.  */  \
+/*  _q          : channel object                                        */  \
+/*  _rng        : generator to copy, or NULL                            */  \
+int CHANNEL(_set_rng)(CHANNEL()  _q,                                        \
+                      liquid_rng _rng);                                     \
+                                                                            \
 /* Apply channel impairments on single input sample                     */  \
 /*  _q      : channel object                                            */  \
 /*  _x      : input sample                                              */  \
@@ -789,6 +874,28 @@ int TVMPCH(_reset)(TVMPCH() _q);                                            \
 /* Print channel object internals to standard output                    */  \
 int TVMPCH(_print)(TVMPCH() _q);                                            \
                                                                             \
+/* Set random number generator used to vary the channel coefficients.   */  \
+/* The object keeps its own copy of _rng; NULL reverts to the global    */  \
+/* rand() state.                                                        */  \
+/*  _q      : channel object                                            */  \
+/*  _rng    : generator to copy, or NULL                                */  \
+int TVMPCH(_set_rng)(TVMPCH()   _q,                                         \
+                     liquid_rng _rng);                                      \
+                                                                            \
+/* Set interval at which the channel coefficients are updated. With an  */  \
+/* interval of one (default) each coefficient takes a random-walk step  */  \
+/* on every sample. Longer intervals draw the coefficients once per     */  \
+/* interval from the equivalent multi-step random walk and interpolate  */  \
+/* linearly between them, reducing the number of random draws by the    */  \
+/* interval; this suits coherence times much longer than the interval.  */  \
+/*  _q          : channel object                                        */  \
+/*  _interval   : update interval [samples], _interval > 0              */  \
+int TVMPCH(_set_update_interval)(TVMPCH()     _q,                           \
+                                 unsigned int _interval);                   \
+                                                                            \
+/* Get interval at which the channel coefficients are updated           */  \
+unsigned int TVMPCH(_get_update_interval)(TVMPCH() _q);                     \
+                                                                            \
 /* Push sample into emulator                                            */  \
 /*  _q      : channel object                                            */  \
 /*  _x      : input sample                                              */  \
@@ -903,7 +1010,9 @@ DOTPROD() DOTPROD(_recreate_rev)(DOTPROD()    _q,                           \
                                  TC *         _v,                           \
                                  unsigned int _n);                          \
                                                                             \
-/* Copy object including all internal objects and state                 */  \
+/* Copy object. Coefficients are immutable and are shared (reference    */  \
+/* counted) with the original rather than duplicated; re-creating       */  \
+/* either object detaches it from the other (copy-on-write).            */  \
 DOTPROD() DOTPROD(_copy)(DOTPROD() _q);                                     \
                                                                             \
 /* Destroy dotprod object, freeing all internal memory                  */  \
@@ -2140,6 +2249,30 @@ int liquid_firdes_prototype(liquid_firfilt_type _type,
 // pretty names for filter design types
 extern const char * liquid_firfilt_type_str[LIQUID_FIRFILT_NUM_TYPES][2];
 
+// Filter design cache: when enabled, the coefficients computed by
+// liquid_firdes_prototype() and firdespm_run() are memoized on their full
+// set of input parameters so that objects created repeatedly with the
+// same design (e.g. synchronizers on newly-activated channels) skip the
+// design step entirely. The cache is global and thread-safe, and is
+// disabled by default.
+int liquid_firdes_cache_enable(void);
+int liquid_firdes_cache_disable(void);
+int liquid_firdes_cache_is_enabled(void);
+
+// Remove all designs from the cache, freeing internal memory
+int liquid_firdes_cache_clear(void);
+
+// Get number of designs currently stored in the cache
+unsigned int liquid_firdes_cache_get_num_entries(void);
+
+// Save cache contents to a binary file so that a later process can
+// load them and skip redesign
+int liquid_firdes_cache_save(const char * _filename);
+
+// Load designs from a file written by liquid_firdes_cache_save(),
+// adding them to any existing entries
+int liquid_firdes_cache_load(const char * _filename);
+
 // returns filter type based on input string
 int liquid_getopt_str2firfilt(const char * _str);
 
@@ -2266,6 +2399,15 @@ int firdespm_destroy(firdespm _q);
 // print firdespm object internals
 int firdespm_print(firdespm _q);
 
+// set grid density (number of grid points per extremal frequency,
+// default 20, minimum 8) and re-build the design grid; zero selects
+// the density automatically, reducing it for long filters to bound
+// design time
+int firdespm_set_grid_density(firdespm _q, unsigned int _density);
+
+// get grid density (number of grid points per extremal frequency)
+unsigned int firdespm_get_grid_density(firdespm _q);
+
 // execute filter design, storing result in _h
 int firdespm_execute(firdespm _q, float * _h);
 
@@ -2802,6 +2944,95 @@ LIQUID_AUTOCORR_DEFINE_API(LIQUID_AUTOCORR_MANGLE_RRRF,
                            float,
                            float)
 
+//
+// multi-lag auto-correlator
+//
+
+#define LIQUID_AUTOCORR_LAGS_MANGLE_CCCF(name) LIQUID_CONCAT(autocorr_lags_cccf,name)
+#define LIQUID_AUTOCORR_LAGS_MANGLE_RRRF(name) LIQUID_CONCAT(autocorr_lags_rrrf,name)
+
+// Macro:
+//   AUTOCORR_LAGS  : name-mangling macro
+//   TO             : output data type
+//   TC             : coefficients data type
+//   TI             : input data type
+#define LIQUID_AUTOCORR_LAGS_DEFINE_API(AUTOCORR_LAGS,TO,TC,TI)             \
+                                                                            \
+/* Computes windowed auto-correlation for all lags 0..L at once         */  \
+typedef struct AUTOCORR_LAGS(_s) * AUTOCORR_LAGS();                         \
+                                                                            \
+/* Create multi-lag auto-correlator object with a particular window     */  \
+/* length and maximum lag                                               */  \
+/*  _window_size    : size of the correlator window, _window_size > 0   */  \
+/*  _max_lag        : maximum lag [samples]                             */  \
+AUTOCORR_LAGS() AUTOCORR_LAGS(_create)(unsigned int _window_size,           \
+                                       unsigned int _max_lag);              \
+                                                                            \
+/* Copy object including all internal objects and state                 */  \
+AUTOCORR_LAGS() AUTOCORR_LAGS(_copy)(AUTOCORR_LAGS() _q);                   \
+                                                                            \
+/* Destroy auto-correlator object, freeing internal memory              */  \
+int AUTOCORR_LAGS(_destroy)(AUTOCORR_LAGS() _q);                            \
+                                                                            \
+/* Reset auto-correlator object's internals                             */  \
+int AUTOCORR_LAGS(_reset)(AUTOCORR_LAGS() _q);                              \
+                                                                            \
+/* Print auto-correlator parameters to stdout                           */  \
+int AUTOCORR_LAGS(_print)(AUTOCORR_LAGS() _q);                              \
+                                                                            \
+/* Get correlator window size                                           */  \
+unsigned int AUTOCORR_LAGS(_get_window_size)(AUTOCORR_LAGS() _q);           \
+                                                                            \
+/* Get maximum lag                                                      */  \
+unsigned int AUTOCORR_LAGS(_get_max_lag)(AUTOCORR_LAGS() _q);               \
+                                                                            \
+/* Push sample into auto-correlator object, updating all lags           */  \
+/*  _q      : auto-correlator object                                    */  \
+/*  _x      : single input sample                                       */  \
+int AUTOCORR_LAGS(_push)(AUTOCORR_LAGS() _q,                                \
+                         TI              _x);                               \
+                                                                            \
+/* Write block of samples to auto-correlator object; for large blocks   */  \
+/* the lags are recomputed with FFTs on the next execute call rather    */  \
+/* than being updated for every sample                                  */  \
+/*  _q      : auto-correlator object                                    */  \
+/*  _x      : input array, [size: _n x 1]                               */  \
+/*  _n      : number of input samples                                   */  \
+int AUTOCORR_LAGS(_write)(AUTOCORR_LAGS() _q,                               \
+                          TI *            _x,                               \
+                          unsigned int    _n);                              \
+                                                                            \
+/* Compute auto-correlation for all lags,                               */  \
+/*   rxx[d] = sum_{k=0}^{W-1} x[n-k] conj(x[n-k-d]),  d = 0..L          */  \
+/*  _q      : auto-correlator object                                    */  \
+/*  _rxx    : auto-correlation output, [size: _max_lag+1 x 1]           */  \
+int AUTOCORR_LAGS(_execute)(AUTOCORR_LAGS() _q,                             \
+                            TO *            _rxx);                          \
+                                                                            \
+/* Write block of samples and compute auto-correlation for all lags at  */  \
+/* the end of the block                                                 */  \
+/*  _q      : auto-correlator object                                    */  \
+/*  _x      : input array, [size: _n x 1]                               */  \
+/*  _n      : number of input samples                                   */  \
+/*  _rxx    : auto-correlation output, [size: _max_lag+1 x 1]           */  \
+int AUTOCORR_LAGS(_execute_block)(AUTOCORR_LAGS() _q,                       \
+                                  TI *            _x,                       \
+                                  unsigned int    _n,                       \
+                                  TO *            _rxx);                    \
+                                                                            \
+/* Return sum of squares of samples in window (zero-lag output)         */  \
+float AUTOCORR_LAGS(_get_energy)(AUTOCORR_LAGS() _q);                       \
+
+LIQUID_AUTOCORR_LAGS_DEFINE_API(LIQUID_AUTOCORR_LAGS_MANGLE_CCCF,
+                                liquid_float_complex,
+                                liquid_float_complex,
+                                liquid_float_complex)
+
+LIQUID_AUTOCORR_LAGS_DEFINE_API(LIQUID_AUTOCORR_LAGS_MANGLE_RRRF,
+                                float,
+                                float,
+                                float)
+
 
 //
 // Finite impulse response filter
@@ -3073,6 +3304,20 @@ int FDELAY(_execute_block)(FDELAY()     _q,                                 \
                            TI *         _x,                                 \
                            unsigned int _n,                                 \
                            TO *         _y);                                \
+                                                                            \
+/* Execute the filter on a block of input samples, applying a different */  \
+/* delay to each; in-place operation is permitted. The object's delay   */  \
+/* is left at the last value in _delay.                                 */  \
+/*  _q      : filter object                                             */  \
+/*  _x      : pointer to input array, [size: _n x 1]                    */  \
+/*  _delay  : pointer to delay array, each in [0,nmax], [size: _n x 1]  */  \
+/*  _n      : number of input, output samples                           */  \
+/*  _y      : pointer to output array, [size: _n x 1]                   */  \
+int FDELAY(_execute_block_delay)(FDELAY()     _q,                           \
+                                 TI *         _x,                           \
+                                 float *      _delay,                       \
+                                 unsigned int _n,                           \
+                                 TO *         _y);                          \
 
 LIQUID_FDELAY_DEFINE_API(LIQUID_FDELAY_MANGLE_RRRF,
                           float,
@@ -3142,6 +3387,30 @@ int FIRHILB(_c2r_execute)(FIRHILB() _q,                                     \
                           T *       _y0,                                    \
                           T *       _y1);                                   \
                                                                             \
+/* Execute Hilbert transform (real to complex) on a block of samples    */  \
+/*  _q      :   Hilbert transform object                                */  \
+/*  _x      :   real-valued input array, [size: _n x 1]                 */  \
+/*  _n      :   number of input, output samples                         */  \
+/*  _y      :   complex-valued output array, [size: _n x 1]             */  \
+int FIRHILB(_r2c_execute_block)(FIRHILB()    _q,                            \
+                                T *          _x,                            \
+                                unsigned int _n,                            \
+                                TC *         _y);                           \
+                                                                            \
+/* Execute Hilbert transform (complex to real) on a block of samples    */  \
+/*  _q      :   Hilbert transform object                                */  \
+/*  _x      :   complex-valued input array, [size: _n x 1]              */  \
+/*  _n      :   number of input, output samples                         */  \
+/*  _y0     :   real-valued output array, lower side-band retained,     */  \
+/*              [size: _n x 1]                                          */  \
+/*  _y1     :   real-valued output array, upper side-band retained,     */  \
+/*              [size: _n x 1]                                          */  \
+int FIRHILB(_c2r_execute_block)(FIRHILB()    _q,                            \
+                                TC *         _x,                            \
+                                unsigned int _n,                            \
+                                T *          _y0,                           \
+                                T *          _y1);                          \
+                                                                            \
 /* Execute Hilbert transform decimator (real to complex)                */  \
 /*  _q      :   Hilbert transform object                                */  \
 /*  _x      :   real-valued input array, [size: 2 x 1]                  */  \
@@ -3615,6 +3884,19 @@ int IIRFILTSOS(_execute_df2)(IIRFILTSOS() _q,                               \
                              TI           _x,                               \
                              TO *         _y);                              \
                                                                             \
+/* compute filter output on a block of samples using state-space        */  \
+/* look-ahead, computing several outputs per iteration from the direct  */  \
+/* form II state at the start of each block; in-place operation is      */  \
+/* permitted                                                            */  \
+/*  _q      : iirfiltsos object                                         */  \
+/*  _x      : input array, [size: _n x 1]                               */  \
+/*  _n      : number of samples                                         */  \
+/*  _y      : output array, [size: _n x 1]                              */  \
+int IIRFILTSOS(_execute_block)(IIRFILTSOS() _q,                             \
+                               TI *         _x,                             \
+                               unsigned int _n,                             \
+                               TO *         _y);                            \
+                                                                            \
 /* compute and return group delay of filter object                      */  \
 /*  _q      : filter object                                             */  \
 /*  _fc     : frequency to evaluate                                     */  \
@@ -3636,6 +3918,262 @@ LIQUID_IIRFILTSOS_DEFINE_API(LIQUID_IIRFILTSOS_MANGLE_CCCF,
                                       liquid_float_complex,
                                       liquid_float_complex)
 
+//
+// iirfilt_multi : multi-channel infinite impulse response filter
+//
+#define LIQUID_IIRFILT_MULTI_MANGLE_RRRF(name) LIQUID_CONCAT(iirfilt_multi_rrrf,name)
+#define LIQUID_IIRFILT_MULTI_MANGLE_CRCF(name) LIQUID_CONCAT(iirfilt_multi_crcf,name)
+#define LIQUID_IIRFILT_MULTI_MANGLE_CCCF(name) LIQUID_CONCAT(iirfilt_multi_cccf,name)
+
+// Macro:
+//   IIRFILT_MULTI : name-mangling macro
+//   TO            : output data type
+//   TC            : coefficients data type
+//   TI            : input data type
+#define LIQUID_IIRFILT_MULTI_DEFINE_API(IIRFILT_MULTI,TO,TC,TI)             \
+                                                                            \
+/* Multi-channel infinite impulse response (IIR) filter applying the    */  \
+/* same cascade of second-order sections to a number of independent     */  \
+/* channels. Channel states are stored contiguously so that each        */  \
+/* section is evaluated for all channels in a single vectorizable loop. */  \
+typedef struct IIRFILT_MULTI(_s) * IIRFILT_MULTI();                         \
+                                                                            \
+/* Create multi-channel IIR filter using 2nd-order sections from        */  \
+/* external coefficients.                                               */  \
+/*  _b              : feed-forward coefficients, [size: _nsos x 3]      */  \
+/*  _a              : feed-back coefficients,    [size: _nsos x 3]      */  \
+/*  _nsos           : number of second-order sections, _nsos > 0        */  \
+/*  _num_channels   : number of channels, _num_channels > 0             */  \
+IIRFILT_MULTI() IIRFILT_MULTI(_create_sos)(TC *         _b,                 \
+                                           TC *         _a,                 \
+                                           unsigned int _nsos,              \
+                                           unsigned int _num_channels);     \
+                                                                            \
+/* Create multi-channel IIR filter from design template; the filter is  */  \
+/* always realized as second-order sections                             */  \
+/*  _ftype          : filter type (e.g. LIQUID_IIRDES_BUTTER)           */  \
+/*  _btype          : band type (e.g. LIQUID_IIRDES_BANDPASS)           */  \
+/*  _order          : filter order, _order > 0                          */  \
+/*  _fc             : low-pass prototype cut-off frequency              */  \
+/*  _f0             : center frequency (band-pass, band-stop)           */  \
+/*  _ap             : pass-band ripple in dB, _ap > 0                   */  \
+/*  _as             : stop-band ripple in dB, _as > 0                   */  \
+/*  _num_channels   : number of channels, _num_channels > 0             */  \
+IIRFILT_MULTI() IIRFILT_MULTI(_create_prototype)(                           \
+                        liquid_iirdes_filtertype _ftype,                    \
+                        liquid_iirdes_bandtype   _btype,                    \
+                        unsigned int             _order,                    \
+                        float                    _fc,                       \
+                        float                    _f0,                       \
+                        float                    _ap,                       \
+                        float                    _as,                       \
+                        unsigned int             _num_channels);            \
+                                                                            \
+/* Create simplified low-pass Butterworth multi-channel IIR filter      */  \
+/*  _order          : filter order, _order > 0                          */  \
+/*  _fc             : low-pass prototype cut-off frequency              */  \
+/*  _num_channels   : number of channels, _num_channels > 0             */  \
+IIRFILT_MULTI() IIRFILT_MULTI(_create_lowpass)(unsigned int _order,         \
+                                               float        _fc,            \
+                                               unsigned int _num_channels); \
+                                                                            \
+/* Create multi-channel first-order DC-blocking filter with transfer    */  \
+/* function \( H(z) = \frac{1 - z^{-1}}{1 - (1-\alpha)z^{-1}} \)        */  \
+/*  _alpha          : normalized filter bandwidth, _alpha > 0           */  \
+/*  _num_channels   : number of channels, _num_channels > 0             */  \
+IIRFILT_MULTI() IIRFILT_MULTI(_create_dc_blocker)(                          \
+                        float        _alpha,                                \
+                        unsigned int _num_channels);                        \
+                                                                            \
+/* Copy object including all internal objects and state                 */  \
+IIRFILT_MULTI() IIRFILT_MULTI(_copy)(IIRFILT_MULTI() _q);                   \
+                                                                            \
+/* Destroy object, freeing all internal memory                          */  \
+int IIRFILT_MULTI(_destroy)(IIRFILT_MULTI() _q);                            \
+                                                                            \
+/* Print object properties to stdout                                    */  \
+int IIRFILT_MULTI(_print)(IIRFILT_MULTI() _q);                              \
+                                                                            \
+/* Reset internal state of all channels                                 */  \
+int IIRFILT_MULTI(_reset)(IIRFILT_MULTI() _q);                              \
+                                                                            \
+/* Reset internal state of a single channel                             */  \
+/*  _q          : filter object                                         */  \
+/*  _channel    : channel index, _channel < num_channels                */  \
+int IIRFILT_MULTI(_reset_channel)(IIRFILT_MULTI() _q,                       \
+                                  unsigned int    _channel);                \
+                                                                            \
+/* Get number of channels                                               */  \
+unsigned int IIRFILT_MULTI(_get_num_channels)(IIRFILT_MULTI() _q);          \
+                                                                            \
+/* Set output scaling for filter                                        */  \
+/*  _q      : filter object                                             */  \
+/*  _scale  : scaling factor to apply to each output sample             */  \
+int IIRFILT_MULTI(_set_scale)(IIRFILT_MULTI() _q, TC _scale);               \
+                                                                            \
+/* Get output scaling for filter                                        */  \
+/*  _q      : filter object                                             */  \
+/*  _scale  : scaling factor applied to each output sample              */  \
+int IIRFILT_MULTI(_get_scale)(IIRFILT_MULTI() _q, TC * _scale);             \
+                                                                            \
+/* Execute filter on a single sample from each channel; in-place        */  \
+/* operation is permitted                                               */  \
+/*  _q      : filter object                                             */  \
+/*  _x      : input samples,  [size: num_channels x 1]                  */  \
+/*  _y      : output samples, [size: num_channels x 1]                  */  \
+int IIRFILT_MULTI(_execute)(IIRFILT_MULTI() _q,                             \
+                            TI *            _x,                             \
+                            TO *            _y);                            \
+                                                                            \
+/* Execute filter on a block of samples from each channel, stored in    */  \
+/* sample-major order (all channels for sample 0, then all channels     */  \
+/* for sample 1, and so on); in-place operation is permitted            */  \
+/*  _q      : filter object                                             */  \
+/*  _x      : input array,  [size: _n x num_channels]                   */  \
+/*  _n      : number of samples per channel                             */  \
+/*  _y      : output array, [size: _n x num_channels]                   */  \
+int IIRFILT_MULTI(_execute_block)(IIRFILT_MULTI() _q,                       \
+                                  TI *            _x,                       \
+                                  unsigned int    _n,                       \
+                                  TO *            _y);                      \
+
+LIQUID_IIRFILT_MULTI_DEFINE_API(LIQUID_IIRFILT_MULTI_MANGLE_RRRF,
+                                float,
+                                float,
+                                float)
+
+LIQUID_IIRFILT_MULTI_DEFINE_API(LIQUID_IIRFILT_MULTI_MANGLE_CRCF,
+                                liquid_float_complex,
+                                float,
+                                liquid_float_complex)
+
+LIQUID_IIRFILT_MULTI_DEFINE_API(LIQUID_IIRFILT_MULTI_MANGLE_CCCF,
+                                liquid_float_complex,
+                                liquid_float_complex,
+                                liquid_float_complex)
+
+//
+// firfilt_multi : multi-channel finite impulse response filter
+//
+#define LIQUID_FIRFILT_MULTI_MANGLE_RRRF(name) LIQUID_CONCAT(firfilt_multi_rrrf,name)
+#define LIQUID_FIRFILT_MULTI_MANGLE_CRCF(name) LIQUID_CONCAT(firfilt_multi_crcf,name)
+#define LIQUID_FIRFILT_MULTI_MANGLE_CCCF(name) LIQUID_CONCAT(firfilt_multi_cccf,name)
+
+// Macro:
+//   FIRFILT_MULTI : name-mangling macro
+//   TO            : output data type
+//   TC            : coefficients data type
+//   TI            : input data type
+#define LIQUID_FIRFILT_MULTI_DEFINE_API(FIRFILT_MULTI,TO,TC,TI)             \
+                                                                            \
+/* Multi-channel finite impulse response (FIR) filter applying the same */  \
+/* coefficients to a number of synchronous channels. Channel histories  */  \
+/* are stored interleaved so that each tap is applied to all channels   */  \
+/* in a single vectorizable loop.                                       */  \
+typedef struct FIRFILT_MULTI(_s) * FIRFILT_MULTI();                         \
+                                                                            \
+/* Create multi-channel FIR filter from external coefficients           */  \
+/*  _h              : filter coefficients, [size: _h_len x 1]           */  \
+/*  _h_len          : filter length, _h_len > 0                         */  \
+/*  _num_channels   : number of channels, _num_channels > 0             */  \
+FIRFILT_MULTI() FIRFILT_MULTI(_create)(TC *         _h,                     \
+                                       unsigned int _h_len,                 \
+                                       unsigned int _num_channels);         \
+                                                                            \
+/* Create multi-channel FIR filter using Kaiser-Bessel windowed sinc    */  \
+/*  _n              : filter length, _n > 0                             */  \
+/*  _fc             : filter normalized cut-off frequency, 0 < _fc < 0.5*/  \
+/*  _as             : filter stop-band attenuation [dB], _as > 0        */  \
+/*  _mu             : fractional sample offset, -0.5 < _mu < 0.5        */  \
+/*  _num_channels   : number of channels, _num_channels > 0             */  \
+FIRFILT_MULTI() FIRFILT_MULTI(_create_kaiser)(unsigned int _n,              \
+                                              float        _fc,             \
+                                              float        _as,             \
+                                              float        _mu,             \
+                                              unsigned int _num_channels);  \
+                                                                            \
+/* Copy object including all internal objects and state                 */  \
+FIRFILT_MULTI() FIRFILT_MULTI(_copy)(FIRFILT_MULTI() _q);                   \
+                                                                            \
+/* Destroy object, freeing all internal memory                          */  \
+int FIRFILT_MULTI(_destroy)(FIRFILT_MULTI() _q);                            \
+                                                                            \
+/* Print object properties to stdout                                    */  \
+int FIRFILT_MULTI(_print)(FIRFILT_MULTI() _q);                              \
+                                                                            \
+/* Reset internal state of all channels                                 */  \
+int FIRFILT_MULTI(_reset)(FIRFILT_MULTI() _q);                              \
+                                                                            \
+/* Reset internal state of a single channel                             */  \
+/*  _q          : filter object                                         */  \
+/*  _channel    : channel index, _channel < num_channels                */  \
+int FIRFILT_MULTI(_reset_channel)(FIRFILT_MULTI() _q,                       \
+                                  unsigned int    _channel);                \
+                                                                            \
+/* Get number of channels                                               */  \
+unsigned int FIRFILT_MULTI(_get_num_channels)(FIRFILT_MULTI() _q);          \
+                                                                            \
+/* Get filter length (number of taps)                                   */  \
+unsigned int FIRFILT_MULTI(_get_length)(FIRFILT_MULTI() _q);                \
+                                                                            \
+/* Set output scaling for filter                                        */  \
+/*  _q      : filter object                                             */  \
+/*  _scale  : scaling factor to apply to each output sample             */  \
+int FIRFILT_MULTI(_set_scale)(FIRFILT_MULTI() _q, TC _scale);               \
+                                                                            \
+/* Get output scaling for filter                                        */  \
+/*  _q      : filter object                                             */  \
+/*  _scale  : scaling factor applied to each output sample              */  \
+int FIRFILT_MULTI(_get_scale)(FIRFILT_MULTI() _q, TC * _scale);             \
+                                                                            \
+/* Execute filter on a single sample from each channel; in-place        */  \
+/* operation is permitted                                               */  \
+/*  _q      : filter object                                             */  \
+/*  _x      : input samples,  [size: num_channels x 1]                  */  \
+/*  _y      : output samples, [size: num_channels x 1]                  */  \
+int FIRFILT_MULTI(_execute)(FIRFILT_MULTI() _q,                             \
+                            TI *            _x,                             \
+                            TO *            _y);                            \
+                                                                            \
+/* Execute filter on a block of samples from each channel, stored in    */  \
+/* sample-major order (all channels for sample 0, then all channels     */  \
+/* for sample 1, and so on); in-place operation is permitted            */  \
+/*  _q      : filter object                                             */  \
+/*  _x      : input array,  [size: _n x num_channels]                   */  \
+/*  _n      : number of samples per channel                             */  \
+/*  _y      : output array, [size: _n x num_channels]                   */  \
+int FIRFILT_MULTI(_execute_block)(FIRFILT_MULTI() _q,                       \
+                                  TI *            _x,                       \
+                                  unsigned int    _n,                       \
+                                  TO *            _y);                      \
+                                                                            \
+/* Execute filter on a block of samples from each channel, stored in    */  \
+/* channel-major order (all samples for channel 0, then all samples     */  \
+/* for channel 1, and so on); in-place operation is permitted           */  \
+/*  _q      : filter object                                             */  \
+/*  _x      : input array,  [size: num_channels x _n]                   */  \
+/*  _n      : number of samples per channel                             */  \
+/*  _y      : output array, [size: num_channels x _n]                   */  \
+int FIRFILT_MULTI(_execute_block_channel_major)(FIRFILT_MULTI() _q,         \
+                                                TI *            _x,         \
+                                                unsigned int    _n,         \
+                                                TO *            _y);        \
+
+LIQUID_FIRFILT_MULTI_DEFINE_API(LIQUID_FIRFILT_MULTI_MANGLE_RRRF,
+                                float,
+                                float,
+                                float)
+
+LIQUID_FIRFILT_MULTI_DEFINE_API(LIQUID_FIRFILT_MULTI_MANGLE_CRCF,
+                                liquid_float_complex,
+                                float,
+                                liquid_float_complex)
+
+LIQUID_FIRFILT_MULTI_DEFINE_API(LIQUID_FIRFILT_MULTI_MANGLE_CCCF,
+                                liquid_float_complex,
+                                liquid_float_complex,
+                                liquid_float_complex)
+
 //
 // FIR Polyphase filter bank
 //
@@ -4368,6 +4906,30 @@ int RESAMP2(_decim_execute)(RESAMP2() _q,                                   \
 int RESAMP2(_interp_execute)(RESAMP2() _q,                                  \
                              TI        _x,                                  \
                              TO *      _y);                                 \
+                                                                            \
+/* Execute resampler as half-band decimator on a block of input         */  \
+/* samples. The delay (center tap) branch is computed by indexing the   */  \
+/* input directly and the filter branch is evaluated on a single        */  \
+/* contiguous buffer, avoiding per-sample window updates.               */  \
+/*  _q  : resampler object                                              */  \
+/*  _x  : input array, [size: 2*_n x 1]                                 */  \
+/*  _n  : number of output samples                                      */  \
+/*  _y  : output array, [size: _n x 1]                                  */  \
+int RESAMP2(_decim_execute_block)(RESAMP2()    _q,                          \
+                                  TI *         _x,                          \
+                                  unsigned int _n,                          \
+                                  TO *         _y);                         \
+                                                                            \
+/* Execute resampler as half-band interpolator on a block of input      */  \
+/* samples.                                                             */  \
+/*  _q  : resampler object                                              */  \
+/*  _x  : input array, [size: _n x 1]                                   */  \
+/*  _n  : number of input samples                                       */  \
+/*  _y  : output array, [size: 2*_n x 1]                                */  \
+int RESAMP2(_interp_execute_block)(RESAMP2()    _q,                         \
+                                   TI *         _x,                         \
+                                   unsigned int _n,                         \
+                                   TO *         _y);                        \
 
 LIQUID_RESAMP2_DEFINE_API(LIQUID_RESAMP2_MANGLE_RRRF,
                           float,
@@ -4939,6 +5501,26 @@ int DDS(_decim_execute)(DDS() _q,                                           \
 int DDS(_interp_execute)(DDS() _q,                                          \
                           TI _x,                                            \
                           TO * _y);                                         \
+                                                                            \
+/* Run DDS object as decimator on a block of samples                    */  \
+/*  _q      : synthesizer object                                        */  \
+/*  _x      : input data array, [size: _n*(1<<_num_stages) x 1]         */  \
+/*  _n      : number of output samples                                  */  \
+/*  _y      : output data array, [size: _n x 1]                         */  \
+int DDS(_decim_execute_block)(DDS()        _q,                              \
+                              TI *         _x,                              \
+                              unsigned int _n,                              \
+                              TO *         _y);                             \
+                                                                            \
+/* Run DDS object as interpolator on a block of samples                 */  \
+/*  _q      : synthesizer object                                        */  \
+/*  _x      : input data array, [size: _n x 1]                          */  \
+/*  _n      : number of input samples                                   */  \
+/*  _y      : output data array, [size: _n*(1<<_num_stages) x 1]        */  \
+int DDS(_interp_execute_block)(DDS()        _q,                             \
+                               TI *         _x,                             \
+                               unsigned int _n,                             \
+                               TO *         _y);                            \
 
 LIQUID_DDS_DEFINE_API(LIQUID_DDS_MANGLE_CCCF,
                       liquid_float_complex,
@@ -5129,6 +5711,21 @@ int FIRFARROW(_execute_block)(FIRFARROW()  _q,                              \
                               unsigned int _n,                              \
                               TO *         _y);                             \
                                                                             \
+/* Execute firfarrow filter on block of samples, applying a different   */  \
+/* fractional delay to each (Farrow structure); the delay set with      */  \
+/* set_delay() is not modified. In-place operation is permitted.        */  \
+/*  _q      : firfarrow object                                          */  \
+/*  _x      : input array, [size: _n x 1]                               */  \
+/*  _mu     : fractional sample delay array, each in [-1,1]             */  \
+/*            [size: _n x 1]                                            */  \
+/*  _n      : input, output array size                                  */  \
+/*  _y      : output array, [size: _n x 1]                              */  \
+int FIRFARROW(_execute_block_delay)(FIRFARROW()  _q,                        \
+                                    TI *         _x,                        \
+                                    float *      _mu,                       \
+                                    unsigned int _n,                        \
+                                    TO *         _y);                       \
+                                                                            \
 /* Get length of firfarrow object (number of filter taps)               */  \
 unsigned int FIRFARROW(_get_length)(FIRFARROW() _q);                        \
                                                                             \
@@ -9210,6 +9807,18 @@ typedef enum {
     LIQUID_VCO_DIRECT
 } liquid_ncotype;
 
+// phase detector for nco phase-locked loop
+typedef enum {
+    // phase of mixed sample; residual carrier or pilot tone
+    LIQUID_PLL_DETECTOR_CARRIER=0,
+
+    // Costas loop for BPSK: imag(y) sign(real(y))
+    LIQUID_PLL_DETECTOR_COSTAS_BPSK,
+
+    // Costas loop for QPSK: imag(y) sign(real(y)) - real(y) sign(imag(y))
+    LIQUID_PLL_DETECTOR_COSTAS_QPSK
+} liquid_pll_detector;
+
 #define LIQUID_NCO_MANGLE_FLOAT(name) LIQUID_CONCAT(nco_crcf, name)
 
 // large macro
@@ -9321,6 +9930,22 @@ int NCO(_pll_set_bandwidth)(NCO() _q,                                       \
 int NCO(_pll_step)(NCO() _q,                                                \
                    T     _dphi);                                            \
                                                                             \
+/* Run phase-locked loop over a block of input samples: each sample is  */  \
+/* mixed down by the nco angle, its phase error computed with the given */  \
+/* detector and applied to the loop filter, and the phase stepped. This */  \
+/* is equivalent, up to rounding, to calling NCO(_mix_down),            */  \
+/* NCO(_pll_step), and NCO(_step) for each sample.                      */  \
+/*  _q          : nco object                                            */  \
+/*  _x          : array of input samples,  [size: _n x 1]               */  \
+/*  _y          : array of output samples, [size: _n x 1]               */  \
+/*  _n          : number of input (and output) samples                  */  \
+/*  _detector   : phase detector type, e.g. LIQUID_PLL_DETECTOR_CARRIER */  \
+int NCO(_pll_execute_block)(NCO()               _q,                         \
+                            TC *                _x,                         \
+                            TC *                _y,                         \
+                            unsigned int        _n,                         \
+                            liquid_pll_detector _detector);                 \
+                                                                            \
 /* Rotate input sample up by nco angle.                                 */  \
 /* Note that this does not adjust the internal phase or frequency.      */  \
 /*  _q      : nco object                                                */  \
@@ -9362,10 +9987,178 @@ int NCO(_mix_block_down)(NCO()        _q,                                   \
                          TC *         _x,                                   \
                          TC *         _y,                                   \
                          unsigned int _n);                                  \
+                                                                            \
+/* Generate complex exponential (stepping)                              */  \
+/* Note that this *does* adjust the internal phase as the signal steps  */  \
+/* through each output sample.                                          */  \
+/*  _q      : nco object                                                */  \
+/*  _y      : array of output samples, [size: _n x 1]                   */  \
+/*  _n      : number of output samples                                  */  \
+int NCO(_generate_block)(NCO()        _q,                                   \
+                         TC *         _y,                                   \
+                         unsigned int _n);                                  \
+                                                                            \
+/* Generate linear frequency chirp (stepping), adjusting the frequency  */  \
+/* by _df after each output sample as with NCO(_adjust_frequency);      */  \
+/* the frequency is retained so successive calls continue the chirp.    */  \
+/* Not supported for type LIQUID_VCO_DIRECT.                            */  \
+/*  _q      : nco object                                                */  \
+/*  _y      : array of output samples, [size: _n x 1]                   */  \
+/*  _n      : number of output samples                                  */  \
+/*  _df     : frequency increment per sample [radians/sample^2]         */  \
+int NCO(_generate_chirp_block)(NCO()        _q,                             \
+                               TC *         _y,                             \
+                               unsigned int _n,                             \
+                               T            _df);                           \
 
 // Define nco APIs
 LIQUID_NCO_DEFINE_API(LIQUID_NCO_MANGLE_FLOAT, float, liquid_float_complex)
 
+#define LIQUID_NCO64_MANGLE_FLOAT(name) LIQUID_CONCAT(nco64_crcf, name)
+
+// large macro
+//   NCO64  : name-mangling macro
+//   T      : primitive data type
+//   TC     : input/output data type
+#define LIQUID_NCO64_DEFINE_API(NCO64,T,TC)                                 \
+                                                                            \
+/* Numerically-controlled oscillator object with 64-bit phase           */  \
+typedef struct NCO64(_s) * NCO64();                                         \
+                                                                            \
+/* Create nco object with 64-bit phase accumulator and frequency word.  */  \
+/* The sine and cosine are evaluated from the upper 32 bits of the      */  \
+/* phase using the same look-up tables as the nco object.               */  \
+/*  _type   : oscillator type, either LIQUID_NCO or LIQUID_VCO_INTERP   */  \
+NCO64() NCO64(_create)(liquid_ncotype _type);                               \
+                                                                            \
+/* Copy object including all internal objects and state                 */  \
+NCO64() NCO64(_copy)(NCO64() _q);                                           \
+                                                                            \
+/* Destroy nco object, freeing all internally allocated memory          */  \
+int NCO64(_destroy)(NCO64() _q);                                            \
+                                                                            \
+/* Print nco object internals to stdout                                 */  \
+int NCO64(_print)(NCO64() _q);                                              \
+                                                                            \
+/* Set phase and frequency to zero                                      */  \
+int NCO64(_reset)(NCO64() _q);                                              \
+                                                                            \
+/* Set frequency of nco object in radians per sample                    */  \
+/* Note that the resolution is limited by the precision of T; use       */  \
+/* NCO64(_set_frequency_word) for exact frequency control.              */  \
+/*  _q      : nco object                                                */  \
+/*  _dtheta : input frequency [radians/sample]                          */  \
+int NCO64(_set_frequency)(NCO64() _q,                                       \
+                          T       _dtheta);                                 \
+                                                                            \
+/* Adjust frequency of nco object by a step size in radians per sample  */  \
+/*  _q      : nco object                                                */  \
+/*  _step   : input frequency step [radians/sample]                     */  \
+int NCO64(_adjust_frequency)(NCO64() _q,                                    \
+                             T       _step);                                \
+                                                                            \
+/* Get frequency of nco object in radians per sample, in [-pi, pi)      */  \
+T NCO64(_get_frequency)(NCO64() _q);                                        \
+                                                                            \
+/* Set frequency of nco object as fixed-point word, where 2^64          */  \
+/* corresponds to 2 pi radians/sample, e.g. round(f/fs * 2^64)          */  \
+/*  _q      : nco object                                                */  \
+/*  _word   : frequency word                                            */  \
+int NCO64(_set_frequency_word)(NCO64()  _q,                                 \
+                               uint64_t _word);                             \
+                                                                            \
+/* Get frequency of nco object as fixed-point word                      */  \
+uint64_t NCO64(_get_frequency_word)(NCO64() _q);                            \
+                                                                            \
+/* Set phase of nco object in radians                                   */  \
+/*  _q      : nco object                                                */  \
+/*  _phi    : input phase [radians]                                     */  \
+int NCO64(_set_phase)(NCO64() _q,                                           \
+                      T       _phi);                                        \
+                                                                            \
+/* Adjust phase of nco object by a step in radians                      */  \
+/*  _q      : nco object                                                */  \
+/*  _dphi   : input phase step [radians]                                */  \
+int NCO64(_adjust_phase)(NCO64() _q,                                        \
+                         T       _dphi);                                    \
+                                                                            \
+/* Get phase of nco object in radians, in [0, 2 pi)                     */  \
+T NCO64(_get_phase)(NCO64() _q);                                            \
+                                                                            \
+/* Set phase of nco object as fixed-point word, where 2^64              */  \
+/* corresponds to 2 pi radians                                          */  \
+/*  _q      : nco object                                                */  \
+/*  _word   : phase word                                                */  \
+int NCO64(_set_phase_word)(NCO64()  _q,                                     \
+                           uint64_t _word);                                 \
+                                                                            \
+/* Get phase of nco object as fixed-point word                          */  \
+uint64_t NCO64(_get_phase_word)(NCO64() _q);                                \
+                                                                            \
+/* Increment phase by internal frequency word                           */  \
+int NCO64(_step)(NCO64() _q);                                               \
+                                                                            \
+/* Compute sine and cosine of internal phase                            */  \
+/*  _q      : nco object                                                */  \
+/*  _s      : output sine component of phase                            */  \
+/*  _c      : output cosine component of phase                          */  \
+int NCO64(_sincos)(NCO64() _q,                                              \
+                   T *     _s,                                              \
+                   T *     _c);                                             \
+                                                                            \
+/* Compute complex exponential of internal phase                        */  \
+/*  _q      : nco object                                                */  \
+/*  _y      : output complex exponential                                */  \
+int NCO64(_cexpf)(NCO64() _q,                                               \
+                  TC *    _y);                                              \
+                                                                            \
+/* Rotate input sample up by nco angle (no stepping)                    */  \
+/*  _q      : nco object                                                */  \
+/*  _x      : input sample                                              */  \
+/*  _y      : output sample                                             */  \
+int NCO64(_mix_up)(NCO64() _q,                                              \
+                   TC      _x,                                              \
+                   TC *    _y);                                             \
+                                                                            \
+/* Rotate input sample down by nco angle (no stepping)                  */  \
+/*  _q      : nco object                                                */  \
+/*  _x      : input sample                                              */  \
+/*  _y      : output sample                                             */  \
+int NCO64(_mix_down)(NCO64() _q,                                            \
+                     TC      _x,                                            \
+                     TC *    _y);                                           \
+                                                                            \
+/* Rotate input vector up by nco angle (stepping)                       */  \
+/*  _q      : nco object                                                */  \
+/*  _x      : array of input samples,  [size: _n x 1]                   */  \
+/*  _y      : array of output samples, [size: _n x 1]                   */  \
+/*  _n      : number of input (and output) samples                      */  \
+int NCO64(_mix_block_up)(NCO64()      _q,                                   \
+                         TC *         _x,                                   \
+                         TC *         _y,                                   \
+                         unsigned int _n);                                  \
+                                                                            \
+/* Rotate input vector down by nco angle (stepping)                     */  \
+/*  _q      : nco object                                                */  \
+/*  _x      : array of input samples,  [size: _n x 1]                   */  \
+/*  _y      : array of output samples, [size: _n x 1]                   */  \
+/*  _n      : number of input (and output) samples                      */  \
+int NCO64(_mix_block_down)(NCO64()      _q,                                 \
+                           TC *         _x,                                 \
+                           TC *         _y,                                 \
+                           unsigned int _n);                                \
+                                                                            \
+/* Generate complex exponential (stepping)                              */  \
+/*  _q      : nco object                                                */  \
+/*  _y      : array of output samples, [size: _n x 1]                   */  \
+/*  _n      : number of output samples                                  */  \
+int NCO64(_generate_block)(NCO64()      _q,                                 \
+                           TC *         _y,                                 \
+                           unsigned int _n);                                \
+
+// Define nco64 APIs
+LIQUID_NCO64_DEFINE_API(LIQUID_NCO64_MANGLE_FLOAT, float, liquid_float_complex)
+
 
 // nco utilities
 
@@ -9429,6 +10222,11 @@ void SYNTH(_mix_block_down)(SYNTH() _q,                                     \
                             TC *_y,                                         \
                             unsigned int _n);                               \
                                                                             \
+/* Generate complex exponential (stepping)                */                \
+void SYNTH(_generate_block)(SYNTH() _q,                                     \
+                           TC *_y,                                          \
+                           unsigned int _n);                                \
+                                                                            \
 void SYNTH(_spread)(SYNTH() _q,                                             \
                     TC _x,                                                  \
                     TC *_y);                                                \
@@ -9822,9 +10620,110 @@ float randnf();
 void awgn(float *_x, float _nstd);
 void crandnf(liquid_float_complex *_y);
 void cawgn(liquid_float_complex *_x, float _nstd);
+
+// Blocks of Gauss random numbers, complex Gauss random numbers, and
+// complex noise added to a block; these are drawn with the ziggurat
+// method from the calling thread's default liquid_rng state (see below)
+// rather than rand()
+int randnf_block(float * _y, unsigned int _n);
+int crandnf_block(liquid_float_complex * _y, unsigned int _n);
+int cawgn_block(liquid_float_complex * _x, unsigned int _n, float _nstd);
 float randnf_pdf(float _x, float _eta, float _sig);
 float randnf_cdf(float _x, float _eta, float _sig);
 
+// Per-object pseudo-random number generator (xoshiro256**) holding its
+// own state so that threads can draw numbers without contending on the
+// global lock inside rand(). Methods given a NULL object use a default
+// state local to the calling thread, seeded distinctly for each thread.
+// The liquid_rng type itself is declared ahead of the channel module
+// which also uses it.
+
+// Create generator object with seed
+liquid_rng liquid_rng_create(uint64_t _seed);
+
+// Create counter-based generator (Philox4x32-10) with seed (key) and
+// stream, starting at offset zero. Each 64-bit output is a function of
+// (seed, stream, offset) only so any point in any stream can be reached
+// in constant time with liquid_rng_set_offset() or liquid_rng_skip().
+liquid_rng liquid_rng_create_counter(uint64_t _seed, uint64_t _stream);
+
+// Copy object including internal state
+liquid_rng liquid_rng_copy(liquid_rng _q);
+
+// Destroy generator object
+int liquid_rng_destroy(liquid_rng _q);
+
+// Print generator state to stdout
+int liquid_rng_print(liquid_rng _q);
+
+// Re-seed generator, setting its state from a 64-bit seed; counter-based
+// generators keep their stream and reset their offset to zero
+int liquid_rng_seed(liquid_rng _q, uint64_t _seed);
+
+// Advance generator state by 2^128 draws; successive jumps from a common
+// seed give non-overlapping streams for parallel simulations. Counter-based
+// generators move to the start of the next stream.
+int liquid_rng_jump(liquid_rng _q);
+
+// Set/get stream of counter-based generator; setting the stream resets
+// the offset to zero
+int      liquid_rng_set_stream(liquid_rng _q, uint64_t _stream);
+uint64_t liquid_rng_get_stream(liquid_rng _q);
+
+// Set/get offset (index of next 64-bit output within stream) of
+// counter-based generator
+int      liquid_rng_set_offset(liquid_rng _q, uint64_t _offset);
+uint64_t liquid_rng_get_offset(liquid_rng _q);
+
+// Skip ahead by _n 64-bit outputs; constant time for counter-based
+// generators, otherwise the outputs are drawn and discarded
+int liquid_rng_skip(liquid_rng _q, uint64_t _n);
+
+// Seed the calling thread's default generator state
+int liquid_rng_default_seed(uint64_t _seed);
+
+// Generate 64 uniformly-distributed random bits
+uint64_t liquid_rng_uint64(liquid_rng _q);
+
+// Uniform random number in [0,1), equivalent of randf()
+float liquid_rng_randf(liquid_rng _q);
+
+// Gauss random number N(0,1), equivalent of randnf()
+float liquid_rng_randnf(liquid_rng _q);
+
+// Add Gauss noise with standard deviation _nstd, equivalent of awgn()
+void liquid_rng_awgn(liquid_rng _q, float * _x, float _nstd);
+
+// Complex Gauss random number, equivalent of crandnf()
+void liquid_rng_crandnf(liquid_rng _q, liquid_float_complex * _y);
+
+// Add complex Gauss noise with standard deviation _nstd, equivalent of
+// cawgn()
+void liquid_rng_cawgn(liquid_rng _q, liquid_float_complex * _x, float _nstd);
+
+// Generate block of uniform random numbers in [0,1), two per 64-bit draw
+int liquid_rng_randf_block(liquid_rng _q, float * _y, unsigned int _n);
+
+// Generate block of Gauss random numbers N(0,1) with the ziggurat method
+int liquid_rng_randnf_block(liquid_rng _q, float * _y, unsigned int _n);
+
+// Generate block of complex Gauss random numbers, E{|y|^2} = 2
+int liquid_rng_crandnf_block(liquid_rng             _q,
+                             liquid_float_complex * _y,
+                             unsigned int           _n);
+
+// Add Gauss noise with standard deviation _nstd to block
+int liquid_rng_awgn_block(liquid_rng   _q,
+                          float *      _x,
+                          unsigned int _n,
+                          float        _nstd);
+
+// Add complex Gauss noise with standard deviation _nstd to block
+int liquid_rng_cawgn_block(liquid_rng             _q,
+                           liquid_float_complex * _x,
+                           unsigned int           _n,
+                           float                  _nstd);
+
 // Exponential
 //  f(x) = lambda exp{ -lambda x }
 // where
@@ -9883,6 +10782,15 @@ float randricekf(float _K, float _omega);
 float randricekf_cdf(float _x, float _K, float _omega);
 float randricekf_pdf(float _x, float _K, float _omega);
 
+// Exponential, Weibull, Gamma, Nakagami-m, and Rice-K random numbers
+// drawn from generator _q (or the calling thread's default generator
+// when _q is NULL) rather than rand()
+float liquid_rng_randexpf  (liquid_rng _q, float _lambda);
+float liquid_rng_randweibf (liquid_rng _q, float _alpha, float _beta, float _gamma);
+float liquid_rng_randgammaf(liquid_rng _q, float _alpha, float _beta);
+float liquid_rng_randnakmf (liquid_rng _q, float _m, float _omega);
+float liquid_rng_randricekf(liquid_rng _q, float _K, float _omega);
+
 
 // Data scrambler : whiten data sequence
 void scramble_data(unsigned char * _x, unsigned int _len);
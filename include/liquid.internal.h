@@ -68,6 +68,43 @@
 // MODULE : buffer
 //
 
+// Acquire/release accesses to indices shared between one producer and
+// one consumer thread, and the cache line size used to keep such
+// indices apart
+#if defined(__GNUC__) || defined(__clang__)
+#  define liquid_atomic_load_acquire(_p)      __atomic_load_n((_p), __ATOMIC_ACQUIRE)
+#  define liquid_atomic_store_release(_p,_v)  __atomic_store_n((_p), (_v), __ATOMIC_RELEASE)
+#elif defined(_MSC_VER)
+#  include <intrin.h>
+#  define liquid_atomic_load_acquire(_p)      ((unsigned int)_InterlockedOr((volatile long *)(_p), 0))
+#  define liquid_atomic_store_release(_p,_v)  _InterlockedExchange((volatile long *)(_p), (long)(_v))
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L && !defined(__STDC_NO_ATOMICS__)
+#  include <stdatomic.h>
+#  define liquid_atomic_load_acquire(_p)      atomic_load_explicit((_Atomic unsigned int *)(_p), memory_order_acquire)
+#  define liquid_atomic_store_release(_p,_v)  atomic_store_explicit((_Atomic unsigned int *)(_p), (_v), memory_order_release)
+#else
+#  error "liquid_atomic: acquire/release operations not supported by this compiler"
+#endif
+#define LIQUID_CACHE_LINE_SIZE (64)
+
+// Allocate memory mapped twice back-to-back so that any region of up
+// to the returned size starting within the first mapping is contiguous,
+// regardless of wrap-around. The requested size is rounded up to a
+// multiple of both the page size and _elem_size.
+//  _num_bytes  : minimum number of bytes in one mapping
+//  _elem_size  : element size the mapping must be a multiple of
+//  _size       : output size of one mapping [bytes]
+// Returns NULL when mirrored memory is not supported on this platform.
+void * liquid_mirror_alloc(unsigned int   _num_bytes,
+                           unsigned int   _elem_size,
+                           unsigned int * _size);
+
+// Free memory allocated with liquid_mirror_alloc()
+//  _p      : pointer to beginning of first mapping
+//  _size   : size of one mapping [bytes]
+int liquid_mirror_free(void *       _p,
+                       unsigned int _size);
+
 
 //
 // MODULE : dotprod
@@ -759,6 +796,29 @@ float estimate_req_filter_len_Herrmann(float _df,
                                        float _as);
 
 
+// firdes cache : memoized filter designs (see liquid_firdes_cache_enable())
+
+// look up design in cache, returning 1 and writing coefficients to _h if
+// an entry with a matching key and length exists, 0 otherwise
+//  _key     : design parameters, packed into an opaque byte array
+//  _key_len : length of key in bytes
+//  _h       : output coefficients array, [size: _h_len x 1]
+//  _h_len   : number of coefficients
+int liquid_firdes_cache_lookup(const void * _key,
+                               unsigned int _key_len,
+                               float *      _h,
+                               unsigned int _h_len);
+
+// store design in cache, replacing nothing if the key already exists
+//  _key     : design parameters, packed into an opaque byte array
+//  _key_len : length of key in bytes
+//  _h       : coefficients array, [size: _h_len x 1]
+//  _h_len   : number of coefficients
+int liquid_firdes_cache_insert(const void *  _key,
+                               unsigned int  _key_len,
+                               const float * _h,
+                               unsigned int  _h_len);
+
 // firdes : finite impulse response filter design
 
 // Find approximate bandwidth adjustment factor rho based on
@@ -1576,11 +1636,35 @@ void optim_sort(float *_v,
 
 #define randf_inline() ((float) rand() / (float) RAND_MAX)
 
+// storage local to each thread, used for default generator state
+#if defined(__GNUC__) || defined(__clang__)
+#  define LIQUID_THREAD_LOCAL __thread
+#elif defined(_MSC_VER)
+#  define LIQUID_THREAD_LOCAL __declspec(thread)
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L && !defined(__STDC_NO_THREADS__)
+#  define LIQUID_THREAD_LOCAL _Thread_local
+#else
+#  error "LIQUID_THREAD_LOCAL: thread-local storage not supported by this compiler"
+#endif
+
 float complex icrandnf();
 
+// calling thread's default generator
+liquid_rng liquid_rng_default(void);
+
+// uniform and complex Gauss random numbers drawn from generator _q, or
+// from rand() when _q is NULL (legacy distribution functions)
+#define LIQUID_RNG_RANDF(_q) ((_q) == NULL ? randf() : liquid_rng_randf(_q))
+#define LIQUID_RNG_CRANDNF(_q,_y)                                       \
+    do { if ((_q) == NULL) crandnf(_y); else liquid_rng_crandnf(_q,_y); } while (0)
+
 // generate x ~ Gamma(delta,1)
 float randgammaf_delta(float _delta);
 
+// generate x ~ Gamma(alpha,beta) or Gamma(delta,1) from generator _q
+float randgammaf_rng      (liquid_rng _q, float _alpha, float _beta);
+float randgammaf_delta_rng(liquid_rng _q, float _delta);
+
 // data scrambler masks
 #define LIQUID_SCRAMBLE_MASK0   (0xb4)
 #define LIQUID_SCRAMBLE_MASK1   (0x6a)
@@ -1596,6 +1680,90 @@ float randgammaf_delta(float _delta);
 // MODULE : utility
 //
 
+// simple spin lock for protecting rarely-contended global state
+#if defined(__GNUC__) || defined(__clang__)
+#  define liquid_spinlock_acquire(_p) while (__atomic_test_and_set((_p), __ATOMIC_ACQUIRE)) {}
+#  define liquid_spinlock_release(_p) __atomic_clear((_p), __ATOMIC_RELEASE)
+#elif defined(_MSC_VER)
+#  include <intrin.h>
+#  define liquid_spinlock_acquire(_p) while (_InterlockedExchange8((volatile char *)(_p), 1)) {}
+#  define liquid_spinlock_release(_p) _InterlockedExchange8((volatile char *)(_p), 0)
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L && !defined(__STDC_NO_ATOMICS__)
+#  include <stdatomic.h>
+#  define liquid_spinlock_acquire(_p) while (atomic_exchange_explicit((_Atomic char *)(_p), 1, memory_order_acquire)) {}
+#  define liquid_spinlock_release(_p) atomic_store_explicit((_Atomic char *)(_p), 0, memory_order_release)
+#else
+#  error "liquid_spinlock: atomic operations not supported by this compiler"
+#endif
+
+// Registry of shared, read-only objects (see src/utility/src/shared.c).
+// Objects are allocated with a hidden header holding their reference count
+// and are registered under the hash of the key they were built from, e.g.
+// their input coefficients and a reversal flag.
+
+// match callback: returns 1 if object _obj was built from key _key
+//  _obj    : registered object
+//  _key    : key data, e.g. input coefficients
+//  _n      : key length (type-specific units)
+//  _rev    : key reversal flag
+typedef int (*liquid_shared_match)(const void * _obj,
+                                   const void * _key,
+                                   unsigned int _n,
+                                   int          _rev);
+
+// compute hash of key for use with the registry
+uint32_t liquid_shared_hash(const void * _key,
+                            unsigned int _key_len,
+                            int          _rev);
+
+// allocate unregistered object with a reference count of one
+void * liquid_shared_alloc(unsigned int _size);
+
+// free object memory once liquid_shared_release() has returned zero
+int liquid_shared_dealloc(void * _obj);
+
+// find registered object of the type identified by _match built from key,
+// retaining and returning it; returns NULL if none exists
+void * liquid_shared_acquire(liquid_shared_match _match,
+                             uint32_t            _hash,
+                             const void *        _key,
+                             unsigned int        _n,
+                             int                 _rev);
+
+// register object allocated with liquid_shared_alloc()
+int liquid_shared_insert(void *              _obj,
+                         liquid_shared_match _match,
+                         uint32_t            _hash,
+                         int                 _rev);
+
+// increment reference count of object
+int liquid_shared_retain(void * _obj);
+
+// decrement reference count of object, removing it from the registry once
+// it reaches zero; returns the number of references left
+unsigned int liquid_shared_release(void * _obj);
+
+// remove object from the registry if the caller holds its only reference,
+// so that it may be modified in place and inserted again; returns 1 if
+// detached, 0 if the object is shared and must be left intact
+int liquid_shared_detach(void * _obj);
+
+// allocate read-only copy of array, sharing an existing allocation with
+// identical contents if one exists; release with liquid_shared_free()
+void * liquid_shared_malloc_copy(const void * _orig,
+                                 unsigned int _num,
+                                 unsigned int _size);
+
+// replace read-only copy _p with one of array _orig, re-using its memory
+// in place if it is not shared (_orig must not point into _p)
+void * liquid_shared_realloc_copy(void *       _p,
+                                  const void * _orig,
+                                  unsigned int _num,
+                                  unsigned int _size);
+
+// release memory allocated with liquid_shared_malloc_copy()
+int liquid_shared_free(void * _p);
+
 // number of ones in a byte
 //  0   0000 0000   :   0
 //  1   0000 0001   :   1
@@ -30,8 +30,17 @@
 
 #include "liquid.internal.h"
 
-// linearize buffer (if necessary)
-int CBUFFER(_linearize)(CBUFFER() _q);
+#if HAVE_SCHED_YIELD
+#  include <sched.h>
+#endif
+
+// linearize buffer so that _n elements starting at read index are
+// contiguous in memory
+int CBUFFER(_linearize)(CBUFFER()    _q,
+                        unsigned int _n);
+
+// wait before polling indices again in blocking methods
+int CBUFFER(_backoff)(unsigned int * _count);
 
 // cbuffer object
 struct CBUFFER(_s) {
@@ -46,15 +55,31 @@ struct CBUFFER(_s) {
 
     // number of elements allocated in memory
     unsigned int num_allocated;
-    
-    // number of elements currently in buffer
+
+    // length of circular index space; equal to max_size unless the
+    // memory is mirrored, in which case it is the mapping length
+    unsigned int ring_len;
+
+    // memory is mirrored (mapped twice back-to-back)?
+    int mirror;
+
+    // single-producer/single-consumer mode? In this mode the number of
+    // elements is derived from the read and write indices, each of
+    // which is written by only one thread, and ring_len is max_size+1
+    // so that a full buffer can be distinguished from an empty one
+    int spsc;
+
+    // number of elements currently in buffer (not used in spsc mode)
     unsigned int num_elements;
-    
-    // index to read
+
+    // index to read, owned by consumer; kept on its own cache line
+    unsigned char pad0[LIQUID_CACHE_LINE_SIZE];
     unsigned int read_index;
-    
-    // index to write
+
+    // index to write, owned by producer; kept on its own cache line
+    unsigned char pad1[LIQUID_CACHE_LINE_SIZE];
     unsigned int write_index;
+    unsigned char pad2[LIQUID_CACHE_LINE_SIZE];
 };
 
 // create circular buffer object of a particular size
@@ -85,6 +110,71 @@ CBUFFER() CBUFFER(_create_max)(unsigned int _max_size,
 
     // allocate internal memory array
     q->v = (T*) malloc((q->num_allocated)*sizeof(T));
+    q->ring_len = q->max_size;
+    q->mirror   = 0;
+    q->spsc     = 0;
+
+    // reset object
+    CBUFFER(_reset)(q);
+
+    // return main object
+    return q;
+}
+
+// create circular buffer object of a particular size using mirrored
+// memory so that reads and writes never need to be linearized; falls
+// back to standard memory when mirroring is not supported
+CBUFFER() CBUFFER(_create_mirror)(unsigned int _max_size)
+{
+    // validate input
+    if (_max_size == 0)
+        return liquid_error_config("error: cbuffer%s_create_mirror(), buffer size must be greater than zero", EXTENSION);
+
+    // try to allocate mirrored memory
+    unsigned int size = 0;
+    T * v = (T*) liquid_mirror_alloc(_max_size*sizeof(T), sizeof(T), &size);
+    if (v == NULL)
+        return CBUFFER(_create_max)(_max_size, _max_size);
+
+    // create main object
+    CBUFFER() q = (CBUFFER()) malloc(sizeof(struct CBUFFER(_s)));
+    q->max_size      = _max_size;
+    q->max_read      = _max_size;
+    q->v             = v;
+    q->ring_len      = size / sizeof(T);
+    q->num_allocated = q->ring_len;
+    q->mirror        = 1;
+    q->spsc          = 0;
+
+    // reset object
+    CBUFFER(_reset)(q);
+
+    // return main object
+    return q;
+}
+
+// create circular buffer object for passing samples from one producer
+// thread to one consumer thread without locks
+CBUFFER() CBUFFER(_create_spsc)(unsigned int _max_size,
+                                unsigned int _max_read)
+{
+    // validate input
+    if (_max_size == 0)
+        return liquid_error_config("error: cbuffer%s_create_spsc(), buffer size must be greater than zero", EXTENSION);
+    if (_max_read == 0)
+        return liquid_error_config("error: cbuffer%s_create_spsc(), maximum read size must be greater than zero", EXTENSION);
+
+    // create main object
+    CBUFFER() q = (CBUFFER()) malloc(sizeof(struct CBUFFER(_s)));
+    q->max_size = _max_size;
+    q->max_read = _max_read > _max_size ? _max_size : _max_read;
+    q->mirror   = 0;
+    q->spsc     = 1;
+
+    // one extra slot separates write index from read index when full
+    q->ring_len      = q->max_size + 1;
+    q->num_allocated = q->ring_len + q->max_read - 1;
+    q->v = (T*) malloc((q->num_allocated)*sizeof(T));
 
     // reset object
     CBUFFER(_reset)(q);
@@ -104,7 +194,26 @@ CBUFFER() CBUFFER(_copy)(CBUFFER() q_orig)
     CBUFFER() q_copy = (CBUFFER()) malloc(sizeof(struct CBUFFER(_s)));
     memmove(q_copy, q_orig, sizeof(struct CBUFFER(_s)));
 
-    // allocate and copy full memory array
+    // allocate and copy full memory array, reverting to standard memory
+    // with the same contents if mirroring fails
+    unsigned int size = 0;
+    if (q_orig->mirror) {
+        q_copy->v = (T*) liquid_mirror_alloc(q_orig->ring_len*sizeof(T), sizeof(T), &size);
+        if (q_copy->v != NULL) {
+            memmove(q_copy->v, q_orig->v, q_copy->num_allocated*sizeof(T));
+            return q_copy;
+        }
+
+        // linearize contents into standard memory
+        q_copy->mirror        = 0;
+        q_copy->ring_len      = q_copy->max_size;
+        q_copy->num_allocated = q_copy->max_size + q_copy->max_read - 1;
+        q_copy->v = (T*) malloc((q_copy->num_allocated)*sizeof(T));
+        memmove(q_copy->v, q_orig->v + q_orig->read_index, q_orig->num_elements*sizeof(T));
+        q_copy->read_index  = 0;
+        q_copy->write_index = q_orig->num_elements % q_copy->max_size;
+        return q_copy;
+    }
     q_copy->v = (T*) malloc((q_copy->num_allocated)*sizeof(T));
     memmove(q_copy->v, q_orig->v, q_copy->num_allocated*sizeof(T));
 
@@ -115,7 +224,10 @@ CBUFFER() CBUFFER(_copy)(CBUFFER() q_orig)
 // destroy cbuffer object, freeing all internal memory
 int CBUFFER(_destroy)(CBUFFER() _q)
 {
-    free(_q->v);
+    if (_q->mirror)
+        liquid_mirror_free(_q->v, _q->ring_len*sizeof(T));
+    else
+        free(_q->v);
     free(_q);
     return LIQUID_OK;
 }
@@ -123,8 +235,9 @@ int CBUFFER(_destroy)(CBUFFER() _q)
 // print cbuffer object properties
 int CBUFFER(_print)(CBUFFER() _q)
 {
-    printf("<cbuffer%s, max_size=%u, max_read=%u, elements=%u>\n",
-        EXTENSION, _q->max_size, _q->max_read, _q->num_elements);
+    printf("<cbuffer%s, max_size=%u, max_read=%u, elements=%u%s>\n",
+        EXTENSION, _q->max_size, _q->max_read, CBUFFER(_size)(_q),
+        _q->spsc ? ", spsc" : "");
     return LIQUID_OK;
 }
 
@@ -140,7 +253,13 @@ int CBUFFER(_reset)(CBUFFER() _q)
 // get the number of elements currently in the buffer
 unsigned int CBUFFER(_size)(CBUFFER() _q)
 {
-    return _q->num_elements;
+    if (!_q->spsc)
+        return _q->num_elements;
+
+    // derive from indices; each is only written by one thread
+    unsigned int w = liquid_atomic_load_acquire(&_q->write_index);
+    unsigned int r = liquid_atomic_load_acquire(&_q->read_index);
+    return w >= r ? w - r : w + _q->ring_len - r;
 }
 
 // get the maximum number of elements the buffer can hold
@@ -159,19 +278,19 @@ unsigned int CBUFFER(_max_read)(CBUFFER() _q)
 // return number of elements available for writing
 unsigned int CBUFFER(_space_available)(CBUFFER() _q)
 {
-    return _q->max_size - _q->num_elements;
+    return _q->max_size - CBUFFER(_size)(_q);
 }
 
 // is buffer empty?
 int CBUFFER(_is_empty)(CBUFFER() _q)
 {
-    return _q->num_elements == 0;
+    return CBUFFER(_size)(_q) == 0;
 }
 
 // is buffer full?
 int CBUFFER(_is_full)(CBUFFER() _q)
 {
-    return (_q->num_elements == _q->max_size ? 1 : 0);
+    return (CBUFFER(_size)(_q) == _q->max_size ? 1 : 0);
 }
 
 // write a single sample into the buffer
@@ -180,6 +299,9 @@ int CBUFFER(_is_full)(CBUFFER() _q)
 int CBUFFER(_push)(CBUFFER() _q,
                    T         _v)
 {
+    if (_q->spsc)
+        return CBUFFER(_write)(_q, &_v, 1);
+
     // ensure buffer isn't already full
     if (_q->num_elements == _q->max_size) {
         return liquid_error(LIQUID_EIRANGE,"cbuffer%s_push(), no space available", EXTENSION);
@@ -189,7 +311,7 @@ int CBUFFER(_push)(CBUFFER() _q,
     _q->v[_q->write_index] = _v;
 
     // update write index
-    _q->write_index = (_q->write_index+1) % _q->max_size;
+    _q->write_index = (_q->write_index+1) % _q->ring_len;
 
     // increment number of elements
     _q->num_elements++;
@@ -205,23 +327,84 @@ int CBUFFER(_write)(CBUFFER()    _q,
                     unsigned int _n)
 {
     // ensure number of samples to write doesn't exceed space available
-    if (_n > (_q->max_size - _q->num_elements)) {
+    if (_n > CBUFFER(_space_available)(_q)) {
         return liquid_error(LIQUID_EIRANGE,"cbuffer%s_write(), cannot write more elements than are available", EXTENSION);
     }
 
-    _q->num_elements += _n;
-    // space available at end of buffer
-    unsigned int k = _q->max_size - _q->write_index;
-    //printf("n : %u, k : %u\n", _n, k);
+    // mirrored memory is contiguous across the wrap-around point
+    unsigned int w = _q->write_index;
+    if (_q->mirror) {
+        memmove(_q->v + w, _v, _n*sizeof(T));
+        w = (w + _n) % _q->ring_len;
+    } else {
+        // space available at end of buffer
+        unsigned int k = _q->ring_len - w;
+
+        // check for condition where we need to wrap around
+        if (_n > k) {
+            memmove(_q->v + w, _v, k*sizeof(T));
+            memmove(_q->v, &_v[k], (_n-k)*sizeof(T));
+            w = _n - k;
+        } else {
+            memmove(_q->v + w, _v, _n*sizeof(T));
+            w = (w + _n) % _q->ring_len;
+        }
+    }
 
-    // check for condition where we need to wrap around
-    if (_n > k) {
-        memmove(_q->v + _q->write_index, _v, k*sizeof(T));
-        memmove(_q->v, &_v[k], (_n-k)*sizeof(T));
-        _q->write_index = _n - k;
+    // publish samples to consumer
+    if (_q->spsc) {
+        liquid_atomic_store_release(&_q->write_index, w);
     } else {
-        memmove(_q->v + _q->write_index, _v, _n*sizeof(T));
-        _q->write_index += _n;
+        _q->write_index   = w;
+        _q->num_elements += _n;
+    }
+    return LIQUID_OK;
+}
+
+// write as many samples to the buffer as space is available without
+// raising an error
+//  _q          : circular buffer object
+//  _v          : input array
+//  _n          : number of samples requested to write
+//  _num_written: number of samples actually written
+int CBUFFER(_write_available)(CBUFFER()      _q,
+                              T *            _v,
+                              unsigned int   _n,
+                              unsigned int * _num_written)
+{
+    unsigned int k = CBUFFER(_space_available)(_q);
+    if (_n > k)
+        _n = k;
+    if (_n > 0)
+        CBUFFER(_write)(_q, _v, _n);
+    if (_num_written != NULL)
+        *_num_written = _n;
+    return LIQUID_OK;
+}
+
+// write samples to the buffer, waiting for space to become available
+//  _q  : circular buffer object
+//  _v  : input array
+//  _n  : number of samples to write
+int CBUFFER(_write_wait)(CBUFFER()    _q,
+                         T *          _v,
+                         unsigned int _n)
+{
+    if (!_q->spsc)
+        return liquid_error(LIQUID_EICONFIG,"cbuffer%s_write_wait(), only supported in single-producer/single-consumer mode", EXTENSION);
+
+    // write in chunks as consumer frees space
+    unsigned int count = 0;
+    while (_n > 0) {
+        unsigned int k;
+        CBUFFER(_write_available)(_q, _v, _n, &k);
+        if (k == 0) {
+            CBUFFER(_backoff)(&count);
+            continue;
+        }
+        _v   += k;
+        _n   -= k;
+        count = 0;
     }
     return LIQUID_OK;
 }
@@ -233,7 +416,7 @@ int CBUFFER(_pop)(CBUFFER() _q,
                   T *       _v)
 {
     // ensure there is at least one element
-    if (_q->num_elements == 0) {
+    if (CBUFFER(_is_empty)(_q)) {
         return liquid_error(LIQUID_EIRANGE,"cbuffer%s_pop(), no elements available",EXTENSION);
     }
 
@@ -241,12 +424,8 @@ int CBUFFER(_pop)(CBUFFER() _q,
     if (_v != NULL)
         *_v = _q->v[ _q->read_index ];
 
-    // increment read index
-    _q->read_index = (_q->read_index + 1) % _q->max_size;
-
-    // decrement number of elements in the buffer
-    _q->num_elements--;
-    return LIQUID_OK;
+    // increment read index and decrement number of elements
+    return CBUFFER(_release)(_q, 1);
 }
 
 // read buffer contents
@@ -260,34 +439,67 @@ int CBUFFER(_read)(CBUFFER()      _q,
                    unsigned int * _num_read)
 {
     // adjust number requested depending upon availability
-    if (_num_requested > _q->num_elements)
-        _num_requested = _q->num_elements;
-    
+    unsigned int num_elements = CBUFFER(_size)(_q);
+    if (_num_requested > num_elements)
+        _num_requested = num_elements;
+
     // restrict maximum number of elements to originally specified value
     if (_num_requested > _q->max_read)
         _num_requested = _q->max_read;
 
     // linearize tail end of buffer if necessary
-    if (_num_requested > (_q->max_size - _q->read_index))
-        CBUFFER(_linearize)(_q);
-    
+    if (!_q->mirror && _num_requested > (_q->ring_len - _q->read_index))
+        CBUFFER(_linearize)(_q, _num_requested);
+
     // set output pointer appropriately
     *_v        = _q->v + _q->read_index;
     *_num_read = _num_requested;
     return LIQUID_OK;
 }
 
+// read buffer contents, waiting until the requested number of
+// elements is available
+//  _q              : circular buffer object
+//  _num_requested  : number of elements requested
+//  _v              : output pointer
+//  _nr             : number of elements referenced by _v
+int CBUFFER(_read_wait)(CBUFFER()      _q,
+                        unsigned int   _num_requested,
+                        T **           _v,
+                        unsigned int * _num_read)
+{
+    if (!_q->spsc)
+        return liquid_error(LIQUID_EICONFIG,"cbuffer%s_read_wait(), only supported in single-producer/single-consumer mode", EXTENSION);
+
+    // restrict to maximum that can be read at once
+    if (_num_requested > _q->max_read)
+        _num_requested = _q->max_read;
+
+    // wait for producer
+    unsigned int count = 0;
+    while (CBUFFER(_size)(_q) < _num_requested)
+        CBUFFER(_backoff)(&count);
+
+    return CBUFFER(_read)(_q, _num_requested, _v, _num_read);
+}
+
 // release _n samples in the buffer
 int CBUFFER(_release)(CBUFFER()    _q,
                       unsigned int _n)
 {
     // advance read_index by _n making sure not to step on write_index
-    if (_n > _q->num_elements) {
+    if (_n > CBUFFER(_size)(_q)) {
         return liquid_error(LIQUID_EIRANGE,"cbuffer%s_release(), cannot release more elements in buffer than exist",EXTENSION);
     }
 
-    _q->read_index = (_q->read_index + _n) % _q->max_size;
-    _q->num_elements -= _n;
+    unsigned int r = (_q->read_index + _n) % _q->ring_len;
+    if (_q->spsc) {
+        // hand space back to producer
+        liquid_atomic_store_release(&_q->read_index, r);
+    } else {
+        _q->read_index    = r;
+        _q->num_elements -= _n;
+    }
     return LIQUID_OK;
 }
 
@@ -297,19 +509,28 @@ int CBUFFER(_release)(CBUFFER()    _q,
 //
 
 // internal linearization
-int CBUFFER(_linearize)(CBUFFER() _q)
+int CBUFFER(_linearize)(CBUFFER()    _q,
+                        unsigned int _n)
 {
-#if 0
-    // check to see if anything needs to be done
-    if ( (_q->max_size - _q->read_index) > _q->num_elements)
-        return;
-#endif
-
-    //printf("cbuffer linearize: [%6u : %6u], num elements: %6u, read index: %6u, write index: %6u\n",
-    //        _q->max_size, _q->max_read-1, _q->num_elements, _q->read_index, _q->write_index);
-
-    // move maximum amount
-    memmove(_q->v + _q->max_size, _q->v, (_q->max_read-1)*sizeof(T));
+    // copy elements which wrapped around to the start of the buffer to
+    // just past its end; only the requested values are copied so that
+    // in spsc mode the consumer never touches unpublished samples
+    unsigned int k = _q->ring_len - _q->read_index;
+    if (_n > k)
+        memmove(_q->v + _q->ring_len, _q->v, (_n - k)*sizeof(T));
     return LIQUID_OK;
 }
 
+// wait before polling indices again in blocking methods: spin briefly,
+// then yield the processor to other threads
+int CBUFFER(_backoff)(unsigned int * _count)
+{
+    if (*_count < 64) {
+        (*_count)++;
+        return LIQUID_OK;
+    }
+#if HAVE_SCHED_YIELD
+    sched_yield();
+#endif
+    return LIQUID_OK;
+}
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2007 - 2025 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+//
+// Double-mapped (mirrored) memory for circular buffers
+//
+// A region of shared memory is mapped twice into adjacent virtual
+// addresses so that writing element i also writes element i+N. Circular
+// buffers built on top of it can hand out contiguous pointers to any
+// region of up to N elements without copying at the wrap-around point.
+//
+
+// needed for memfd_create() declaration
+#ifndef _GNU_SOURCE
+#  define _GNU_SOURCE
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "liquid.internal.h"
+
+#if HAVE_MEMFD_CREATE
+#  include <sys/mman.h>
+#  include <unistd.h>
+#endif
+
+void * liquid_mirror_alloc(unsigned int   _num_bytes,
+                           unsigned int   _elem_size,
+                           unsigned int * _size)
+{
+#if HAVE_MEMFD_CREATE
+    // round size up to multiple of page size and element size
+    long page = sysconf(_SC_PAGESIZE);
+    if (_num_bytes == 0 || _elem_size == 0 || page <= 0)
+        return NULL;
+    size_t size = ((_num_bytes + page - 1) / page) * page;
+    while (size % _elem_size)
+        size += page;
+
+    // create anonymous file to back both mappings
+    int fd = memfd_create("liquid-mirror", MFD_CLOEXEC);
+    if (fd < 0)
+        return NULL;
+    if (ftruncate(fd, size) != 0) {
+        close(fd);
+        return NULL;
+    }
+
+    // reserve contiguous address range for both mappings, then map file
+    // into each half
+    unsigned char * p = (unsigned char*) mmap(NULL, 2*size, PROT_NONE,
+                                              MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (p == MAP_FAILED) {
+        close(fd);
+        return NULL;
+    }
+    if (mmap(p,      size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED ||
+        mmap(p+size, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED)
+    {
+        munmap(p, 2*size);
+        close(fd);
+        return NULL;
+    }
+
+    // mappings keep the file alive
+    close(fd);
+    *_size = (unsigned int) size;
+    return p;
+#else
+    return NULL;
+#endif
+}
+
+int liquid_mirror_free(void *       _p,
+                       unsigned int _size)
+{
+#if HAVE_MEMFD_CREATE
+    if (munmap(_p, 2*(size_t)_size) != 0)
+        return liquid_error(LIQUID_EINT,"liquid_mirror_free(), could not unmap memory");
+    return LIQUID_OK;
+#else
+    return liquid_error(LIQUID_EINT,"liquid_mirror_free(), mirrored memory not supported");
+#endif
+}
@@ -33,14 +33,17 @@
 struct WINDOW(_s) {
     T * v;                      // allocated array pointer
     unsigned int len;           // length of window
-    unsigned int m;             // floor(log2(len)) + 1
-    unsigned int n;             // 2^m
-    unsigned int mask;          // n-1
+    unsigned int slack;         // number of samples which can be pushed
+                                // before memory needs to be compacted
     unsigned int num_allocated; // number of elements allocated
-                                // in memory
+                                // in memory, len - 1 + slack
     unsigned int read_index;
+    int          mirror;        // memory is mirrored (mapped twice)?
 };
 
+// default slack: smallest power of two greater than window length
+#define WINDOW_DEFAULT_SLACK(n) (1U << liquid_msb_index(n))
+
 // create window buffer object of length _n
 WINDOW() WINDOW(_create)(unsigned int _n)
 {
@@ -48,21 +51,65 @@ WINDOW() WINDOW(_create)(unsigned int _n)
     if (_n == 0)
         return liquid_error_config("error: window%s_create(), window size must be greater than zero", EXTENSION);
 
+    return WINDOW(_create_slack)(_n, WINDOW_DEFAULT_SLACK(_n));
+}
+
+// create window buffer object of length _n with extra memory allocated
+// so that _slack samples may be written between compactions
+WINDOW() WINDOW(_create_slack)(unsigned int _n,
+                               unsigned int _slack)
+{
+    // validate input
+    if (_n == 0)
+        return liquid_error_config("error: window%s_create_slack(), window size must be greater than zero", EXTENSION);
+    if (_slack == 0)
+        return liquid_error_config("error: window%s_create_slack(), slack must be greater than zero", EXTENSION);
+
     // create initial object
     WINDOW() q = (WINDOW()) malloc(sizeof(struct WINDOW(_s)));
 
     // set internal parameters
-    q->len  = _n;                   // nominal window size
-    q->m    = liquid_msb_index(_n); // effectively floor(log2(len))+1
-    q->n    = 1<<(q->m);            // 2^m
-    q->mask = q->n - 1;             // bit mask
+    q->len   = _n;      // nominal window size
+    q->slack = _slack;  // samples between compactions
 
     // number of elements to allocate to memory
-    q->num_allocated = q->n + q->len - 1;
+    q->num_allocated = q->len - 1 + q->slack;
 
     // allocate memory
     q->v = (T*) malloc((q->num_allocated)*sizeof(T));
     q->read_index = 0;
+    q->mirror     = 0;
+
+    // reset window
+    WINDOW(_reset)(q);
+
+    // return object
+    return q;
+}
+
+// create window buffer object of length _n using mirrored memory so
+// that the buffer never needs to be compacted; falls back to standard
+// memory when mirroring is not supported
+WINDOW() WINDOW(_create_mirror)(unsigned int _n)
+{
+    // validate input
+    if (_n == 0)
+        return liquid_error_config("error: window%s_create_mirror(), window size must be greater than zero", EXTENSION);
+
+    // try to allocate mirrored memory
+    unsigned int size = 0;
+    T * v = (T*) liquid_mirror_alloc(_n*sizeof(T), sizeof(T), &size);
+    if (v == NULL)
+        return WINDOW(_create)(_n);
+
+    // create object; all memory in one mapping is part of the ring
+    WINDOW() q = (WINDOW()) malloc(sizeof(struct WINDOW(_s)));
+    q->len           = _n;
+    q->slack         = 0;
+    q->num_allocated = size / sizeof(T);
+    q->v             = v;
+    q->read_index    = 0;
+    q->mirror        = 1;
 
     // reset window
     WINDOW(_reset)(q);
@@ -81,25 +128,24 @@ WINDOW() WINDOW(_recreate)(WINDOW() _q, unsigned int _n)
     if (_n == _q->len)
         return _q;
 
-    // create new window
-    WINDOW() w = WINDOW(_create)(_n);
+    // create new window, retaining mirrored memory or non-default slack
+    WINDOW() w = NULL;
+    if (_q->mirror) {
+        w = WINDOW(_create_mirror)(_n);
+    } else {
+        unsigned int slack = _q->slack == WINDOW_DEFAULT_SLACK(_q->len) ?
+                             WINDOW_DEFAULT_SLACK(_n) : _q->slack;
+        w = WINDOW(_create_slack)(_n, slack);
+    }
 
-    // copy old values
+    // copy old values; new window is initialized with zeros so when it
+    // is larger the old values are simply written after them
     T* r;
     WINDOW(_read)(_q, &r);
-    //memmove(q->v, ...);
-    unsigned int i;
-    if (_n > _q->len) {
-        // new buffer is larger; push zeros, then old values
-        for (i=0; i<(_n-_q->len); i++)
-            WINDOW(_push)(w, 0);
-        for (i=0; i<_q->len; i++)
-            WINDOW(_push)(w, r[i]);
-    } else {
-        // new buffer is shorter; push latest old values
-        for (i=(_q->len-_n); i<_q->len; i++)
-            WINDOW(_push)(w, r[i]);
-    }
+    if (_n > _q->len)
+        WINDOW(_write)(w, r, _q->len);
+    else
+        WINDOW(_write)(w, r + _q->len - _n, _n);
 
     // destroy old window
     WINDOW(_destroy)(_q);
@@ -119,6 +165,23 @@ WINDOW() WINDOW(_copy)(WINDOW() q_orig)
     memmove(q_copy, q_orig, sizeof(struct WINDOW(_s)));
 
     // allocate and copy full memory array
+    if (q_orig->mirror) {
+        unsigned int size = 0;
+        q_copy->v = (T*) liquid_mirror_alloc(q_orig->num_allocated*sizeof(T), sizeof(T), &size);
+        if (q_copy->v != NULL) {
+            memmove(q_copy->v, q_orig->v, q_copy->num_allocated*sizeof(T));
+            return q_copy;
+        }
+
+        // revert to standard memory holding only the window contents
+        q_copy->slack         = WINDOW_DEFAULT_SLACK(q_copy->len);
+        q_copy->num_allocated = q_copy->len - 1 + q_copy->slack;
+        q_copy->read_index    = 0;
+        q_copy->mirror        = 0;
+        q_copy->v = (T*) malloc((q_copy->num_allocated)*sizeof(T));
+        memmove(q_copy->v, q_orig->v + q_orig->read_index, q_copy->len*sizeof(T));
+        return q_copy;
+    }
     q_copy->v = (T*) liquid_malloc_copy(q_copy->v, q_copy->num_allocated, sizeof(T));
 
     // return new object
@@ -129,7 +192,10 @@ WINDOW() WINDOW(_copy)(WINDOW() q_orig)
 int WINDOW(_destroy)(WINDOW() _q)
 {
     // free internal memory array
-    free(_q->v);
+    if (_q->mirror)
+        liquid_mirror_free(_q->v, _q->num_allocated*sizeof(T));
+    else
+        free(_q->v);
 
     // free main object memory
     free(_q);
@@ -213,20 +279,33 @@ int WINDOW(_index)(WINDOW()     _q,
     return LIQUID_OK;
 }
 
+// get number of samples which may be pushed between compactions; zero
+// for mirrored windows which are never compacted
+unsigned int WINDOW(_get_slack)(WINDOW() _q)
+{
+    return _q->slack;
+}
+
 // push single element onto window buffer
 //  _q      : window object
 //  _v      : single input element
 int WINDOW(_push)(WINDOW() _q, T _v)
 {
-    // increment index
-    _q->read_index++;
-
-    // wrap around pointer
-    _q->read_index &= _q->mask;
+    // mirrored memory: append at end of ring and advance read index
+    if (_q->mirror) {
+        _q->v[_q->read_index + _q->len] = _v;
+        _q->read_index = _q->read_index + 1 == _q->num_allocated ? 0 : _q->read_index + 1;
+        return LIQUID_OK;
+    }
 
-    // if pointer wraps around, copy excess memory
-    if (_q->read_index == 0)
-        memmove(_q->v, _q->v + _q->n, (_q->len-1)*sizeof(T));
+    // if there is no more room at end of buffer, copy most recent
+    // len-1 values to beginning of memory
+    if (_q->read_index + _q->len == _q->num_allocated) {
+        memmove(_q->v, _q->v + _q->read_index + 1, (_q->len-1)*sizeof(T));
+        _q->read_index = 0;
+    } else {
+        _q->read_index++;
+    }
 
     // append value to end of buffer
     _q->v[_q->read_index + _q->len - 1] = _v;
@@ -241,10 +320,31 @@ int WINDOW(_write)(WINDOW()     _q,
                    T *          _v,
                    unsigned int _n)
 {
-    // TODO make this more efficient
-    unsigned int i;
-    for (i=0; i<_n; i++)
-        WINDOW(_push)(_q, _v[i]);
+    if (_n >= _q->len) {
+        // input replaces entire window; retain only most recent values
+        _q->read_index = 0;
+        memmove(_q->v, _v + _n - _q->len, _q->len*sizeof(T));
+        return LIQUID_OK;
+    }
+
+    // mirrored memory is contiguous across the wrap-around point
+    if (_q->mirror) {
+        memmove(_q->v + (_q->read_index + _q->len) % _q->num_allocated, _v, _n*sizeof(T));
+        _q->read_index = (_q->read_index + _n) % _q->num_allocated;
+        return LIQUID_OK;
+    }
+
+    // compact once if there is not enough room at end of buffer,
+    // retaining the len-_n values which remain in the window
+    if (_q->read_index + _q->len + _n > _q->num_allocated) {
+        memmove(_q->v, _q->v + _q->read_index + _n, (_q->len-_n)*sizeof(T));
+        _q->read_index = 0;
+    } else {
+        _q->read_index += _n;
+    }
+
+    // append block to end of buffer
+    memmove(_q->v + _q->read_index + _q->len - _n, _v, _n*sizeof(T));
     return LIQUID_OK;
 }
 
@@ -20,6 +20,7 @@
  * THE SOFTWARE.
  */
 
+#include <string.h>
 #include "autotest/autotest.h"
 #include "liquid.internal.h"
 
@@ -34,6 +35,8 @@ void autotest_window_config_errors()
 #endif
     CONTEND_EXPRESSION(windowcf_create(0)==NULL);
     CONTEND_EXPRESSION(windowf_create (0)==NULL);
+    CONTEND_EXPRESSION(windowf_create_slack(0,8)==NULL);
+    CONTEND_EXPRESSION(windowf_create_slack(8,0)==NULL);
 }
 
 void autotest_windowf()
@@ -174,3 +177,94 @@ void autotest_window_copy()
     windowcf_destroy(q1);
 }
 
+
+// compare block writes of random sizes against a reference linear buffer
+void testbench_window_write(unsigned int _len,
+                            unsigned int _slack,
+                            int          _mirror)
+{
+    windowf q = NULL;
+    if (_mirror)
+        q = windowf_create_mirror(_len);
+    else if (_slack == 0)
+        q = windowf_create(_len);
+    else
+        q = windowf_create_slack(_len, _slack);
+    if (_slack != 0)
+        CONTEND_EQUALITY(windowf_get_slack(q), _slack);
+
+    // reference holds all samples written, newest at end
+    unsigned int num_samples = 20*_len + 400;
+    float ref[num_samples + _len];
+    unsigned int i, j, n = _len;
+    for (i=0; i<_len; i++)
+        ref[i] = 0.0f;
+
+    float * r;
+    float   x[2*_len + 2];
+    while (n < num_samples + _len) {
+        // write block of random length up to just over twice the window,
+        // occasionally pushing a single sample instead
+        unsigned int num_write = rand() % (2*_len + 2);
+        if (n + num_write > num_samples + _len)
+            num_write = num_samples + _len - n;
+        for (j=0; j<num_write; j++) {
+            x[j] = (float)(n + j);
+            ref[n + j] = x[j];
+        }
+        if (num_write == 1 || (rand() % 4) == 0) {
+            for (j=0; j<num_write; j++)
+                windowf_push(q, x[j]);
+        } else {
+            windowf_write(q, x, num_write);
+        }
+        n += num_write;
+
+        windowf_read(q, &r);
+        CONTEND_SAME_DATA(r, ref + n - _len, _len*sizeof(float));
+    }
+    windowf_destroy(q);
+}
+
+void autotest_window_write_len1()           { testbench_window_write(   1,  0, 0); }
+void autotest_window_write_len7()           { testbench_window_write(   7,  0, 0); }
+void autotest_window_write_len16()          { testbench_window_write(  16,  0, 0); }
+void autotest_window_write_len37()          { testbench_window_write(  37,  0, 0); }
+void autotest_window_write_len37_slack1()   { testbench_window_write(  37,  1, 0); }
+void autotest_window_write_len37_slack5()   { testbench_window_write(  37,  5, 0); }
+void autotest_window_write_len37_slack400() { testbench_window_write(  37,400, 0); }
+void autotest_window_write_len1_mirror()    { testbench_window_write(   1,  0, 1); }
+void autotest_window_write_len37_mirror()   { testbench_window_write(  37,  0, 1); }
+void autotest_window_write_len1024_mirror() { testbench_window_write(1024,  0, 1); }
+void autotest_window_write_len1500_mirror() { testbench_window_write(1500,  0, 1); }
+
+// mirrored window supports copy and recreate like the standard one
+void autotest_window_mirror_copy()
+{
+    unsigned int i, wlen = 1024;
+    windowcf q0 = windowcf_create_mirror(wlen);
+    for (i=0; i<3*wlen/2; i++)
+        windowcf_push(q0, randnf() + _Complex_I*randnf());
+
+    // copy object and push more values to both
+    windowcf q1 = windowcf_copy(q0);
+    for (i=0; i<wlen; i++) {
+        float complex v = randnf() + _Complex_I*randnf();
+        windowcf_push(q0, v);
+        windowcf_push(q1, v);
+    }
+    float complex * r0, * r1;
+    windowcf_read(q0, &r0);
+    windowcf_read(q1, &r1);
+    CONTEND_SAME_DATA(r0, r1, wlen*sizeof(float complex));
+
+    // shrink window, retaining most recent values
+    float complex v[wlen];
+    memmove(v, r0, wlen*sizeof(float complex));
+    q0 = windowcf_recreate(q0, 100);
+    windowcf_read(q0, &r0);
+    CONTEND_SAME_DATA(r0, v + wlen - 100, 100*sizeof(float complex));
+
+    windowcf_destroy(q0);
+    windowcf_destroy(q1);
+}
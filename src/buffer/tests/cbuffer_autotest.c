@@ -376,3 +376,184 @@ void autotest_cbuffer_copy()
     cbuffercf_destroy(q1);
 }
 
+
+// test general flow with mirrored memory; every read returns all
+// available samples as a contiguous array
+void autotest_cbufferf_mirror_flow()
+{
+    unsigned int max_size     = 1500;  // maximum number of elements in buffer
+    unsigned int num_elements = 40000; // total number of elements for run
+
+    cbufferf q = cbufferf_create_mirror(max_size);
+    CONTEND_EQUALITY(cbufferf_max_size(q), max_size);
+    CONTEND_EQUALITY(cbufferf_max_read(q), max_size);
+
+    float        write_buffer[max_size];
+    unsigned int i, write_id = 0, read_id = 0;
+    while (read_id < num_elements) {
+        // write random number of samples, occasionally one at a time
+        unsigned int num_available_to_write = cbufferf_space_available(q);
+        if (num_available_to_write > 0) {
+            unsigned int num_to_write = (rand() % num_available_to_write) + 1;
+            for (i=0; i<num_to_write; i++)
+                write_buffer[i] = (float)(write_id++);
+            if (num_to_write < 4) {
+                for (i=0; i<num_to_write; i++)
+                    cbufferf_push(q, write_buffer[i]);
+            } else {
+                cbufferf_write(q, write_buffer, num_to_write);
+            }
+        }
+
+        // read all samples but release only some of them
+        float *      r;
+        unsigned int num_read;
+        cbufferf_read(q, max_size, &r, &num_read);
+        CONTEND_EQUALITY(num_read, cbufferf_size(q));
+        for (i=0; i<num_read; i++)
+            CONTEND_EQUALITY(r[i], (float)(read_id + i));
+        unsigned int num_release = num_read == 0 ? 0 : (rand() % num_read) + 1;
+        cbufferf_release(q, num_release);
+        read_id += num_release;
+    }
+    cbufferf_destroy(q);
+}
+
+// test copy with mirrored memory after buffer has wrapped around
+void autotest_cbuffer_mirror_copy()
+{
+    unsigned int wlen = 1024;
+    cbuffercf q0 = cbuffercf_create_mirror(wlen);
+
+    // fill buffer, release most values, and fill again to wrap around
+    unsigned int i;
+    while (cbuffercf_space_available(q0))
+        cbuffercf_push(q0, randnf() + _Complex_I*randnf());
+    cbuffercf_release(q0, wlen - 10);
+    while (cbuffercf_space_available(q0) > 3)
+        cbuffercf_push(q0, randnf() + _Complex_I*randnf());
+
+    // copy object and release/write same values on both
+    cbuffercf q1 = cbuffercf_copy(q0);
+    cbuffercf_release(q0, 100);
+    cbuffercf_release(q1, 100);
+    for (i=0; i<50; i++) {
+        float complex v = randnf() + _Complex_I*randnf();
+        cbuffercf_push(q0, v);
+        cbuffercf_push(q1, v);
+    }
+    CONTEND_EQUALITY(cbuffercf_size(q0), cbuffercf_size(q1));
+
+    // read buffers and compare
+    unsigned int nr0, nr1;
+    float complex * r0, * r1;
+    cbuffercf_read(q0, wlen, &r0, &nr0);
+    cbuffercf_read(q1, wlen, &r1, &nr1);
+    CONTEND_EQUALITY(nr0, nr1);
+    CONTEND_EQUALITY(nr0, cbuffercf_size(q0));
+    CONTEND_SAME_DATA(r0, r1, nr0*sizeof(float complex));
+
+    cbuffercf_destroy(q0);
+    cbuffercf_destroy(q1);
+}
+
+// push after a write which ends exactly at the end of memory
+void autotest_cbufferf_push_after_write()
+{
+    float x[4] = {1, 2, 3, 4};
+    float * r;
+    unsigned int num_read;
+    cbufferf q = cbufferf_create(4);
+    cbufferf_write  (q, x, 4);
+    cbufferf_release(q, 2);
+    cbufferf_push   (q, 5);
+    cbufferf_read   (q, 3, &r, &num_read);
+    CONTEND_EQUALITY(num_read, 3);
+    CONTEND_EQUALITY(r[0], 3);
+    CONTEND_EQUALITY(r[1], 4);
+    CONTEND_EQUALITY(r[2], 5);
+    cbufferf_destroy(q);
+}
+
+// test single-producer/single-consumer flow from one thread, exercising
+// wrap-around, partial writes, and the blocking methods when they do not
+// need to wait
+void autotest_cbufferf_spsc_flow()
+{
+    unsigned int max_size     =   48;  // maximum number of elements in buffer
+    unsigned int max_read     =   17;  // maximum number of elements to read
+    unsigned int num_elements = 4000;  // total number of elements for run
+
+    cbufferf q = cbufferf_create_spsc(max_size, max_read);
+    CONTEND_EQUALITY(cbufferf_max_size(q), max_size);
+    CONTEND_EQUALITY(cbufferf_max_read(q), max_read);
+    CONTEND_EQUALITY(cbufferf_print(q), LIQUID_OK);
+
+    float        write_buffer[2*max_size];
+    unsigned int i, write_id = 0, read_id = 0, num_written, num_read;
+    float *      r;
+    while (read_id < num_elements) {
+        // request more than may fit; only available space is written
+        unsigned int num_to_write = rand() % (2*max_size);
+        for (i=0; i<num_to_write; i++)
+            write_buffer[i] = (float)(write_id + i);
+        unsigned int space = cbufferf_space_available(q);
+        if (rand() % 2) {
+            cbufferf_write_available(q, write_buffer, num_to_write, &num_written);
+        } else {
+            num_written = num_to_write < space ? num_to_write : space;
+            cbufferf_write_wait(q, write_buffer, num_written);
+        }
+        CONTEND_EQUALITY(num_written, num_to_write < space ? num_to_write : space);
+        write_id += num_written;
+
+        // read what is available
+        unsigned int num_to_read = rand() % (cbufferf_size(q) + 1);
+        cbufferf_read_wait(q, num_to_read, &r, &num_read);
+        CONTEND_EQUALITY(num_read, num_to_read < max_read ? num_to_read : max_read);
+        for (i=0; i<num_read; i++)
+            CONTEND_EQUALITY(r[i], (float)(read_id + i));
+        cbufferf_release(q, num_read);
+        read_id += num_read;
+
+        // occasionally pop single value
+        if (!cbufferf_is_empty(q) && (rand() % 4) == 0) {
+            float v;
+            cbufferf_pop(q, &v);
+            CONTEND_EQUALITY(v, (float)read_id);
+            read_id++;
+        }
+    }
+    CONTEND_EQUALITY(cbufferf_size(q), write_id - read_id);
+    cbufferf_destroy(q);
+}
+
+// test invalid configurations for spsc mode
+void autotest_cbufferf_spsc_config()
+{
+#if LIQUID_STRICT_EXIT
+    AUTOTEST_WARN("skipping cbuffer spsc config test with strict exit enabled\n");
+    return;
+#endif
+#if !LIQUID_SUPPRESS_ERROR_OUTPUT
+    fprintf(stderr,"warning: ignore potential errors here; checking for invalid configurations\n");
+#endif
+    CONTEND_ISNULL(cbufferf_create_spsc(0, 4));
+    CONTEND_ISNULL(cbufferf_create_spsc(4, 0));
+
+    // blocking methods are only available in spsc mode
+    float x[4] = {0, 0, 0, 0}, *r;
+    unsigned int num_read;
+    cbufferf q = cbufferf_create(4);
+    CONTEND_EQUALITY(cbufferf_write_wait(q, x, 4),            LIQUID_EICONFIG);
+    CONTEND_EQUALITY(cbufferf_read_wait (q, 4, &r, &num_read), LIQUID_EICONFIG);
+    cbufferf_destroy(q);
+
+    // spsc buffer holds exactly max_size elements
+    q = cbufferf_create_spsc(4, 4);
+    CONTEND_EQUALITY(cbufferf_write(q, x, 4), LIQUID_OK);
+    CONTEND_EQUALITY(cbufferf_is_full(q), 1);
+    CONTEND_INEQUALITY(cbufferf_push(q, 0), LIQUID_OK);
+    CONTEND_INEQUALITY(cbufferf_release(q, 5), LIQUID_OK);
+    cbufferf_destroy(q);
+}
@@ -29,6 +29,9 @@
 #include <stdio.h>
 #include <math.h>
 
+// number of shadowing gains computed at a time in execute_block()
+#define CHANNEL_SHADOWING_BLOCK (256)
+
 // portable structured channel object
 struct CHANNEL(_s) {
     // additive white Gauss noise
@@ -55,6 +58,9 @@ struct CHANNEL(_s) {
     IIRFILT()       shadowing_filter;   // shadowing filter object
     float           shadowing_std;      // shadowing standard deviation
     float           shadowing_fd;       // shadowing Doppler frequency
+
+    // random number generator (NULL to use rand())
+    liquid_rng      rng;
 };
 
 // create structured channel object with default parameters
@@ -75,6 +81,7 @@ CHANNEL() CHANNEL(_create)(void)
     q->h[0]             = 1.0f;
     q->channel_filter   = FIRFILT(_create)(q->h, q->h_len);
     q->shadowing_filter = NULL;
+    q->rng              = NULL;
 
     // return object
     return q;
@@ -103,6 +110,10 @@ CHANNEL() CHANNEL(_copy)(CHANNEL() q_orig)
     if (q_orig->shadowing_filter != NULL)
         q_copy->shadowing_filter = IIRFILT(_copy)(q_orig->shadowing_filter);
 
+    // copy random number generator, including its state
+    if (q_orig->rng != NULL)
+        q_copy->rng = liquid_rng_copy(q_orig->rng);
+
     return q_copy;
 }
 
@@ -114,6 +125,8 @@ int CHANNEL(_destroy)(CHANNEL() _q)
     FIRFILT(_destroy)(_q->channel_filter);
     if (_q->shadowing_filter != NULL)
         IIRFILT(_destroy)(_q->shadowing_filter);
+    if (_q->rng != NULL)
+        liquid_rng_destroy(_q->rng);
     free(_q->h);
 
     // free main object memory
@@ -132,6 +145,16 @@ int CHANNEL(_print)(CHANNEL() _q)
     return LIQUID_OK;
 }
 
+// set random number generator (copied), or NULL to use rand()
+int CHANNEL(_set_rng)(CHANNEL()  _q,
+                      liquid_rng _rng)
+{
+    if (_q->rng != NULL)
+        liquid_rng_destroy(_q->rng);
+    _q->rng = _rng == NULL ? NULL : liquid_rng_copy(_rng);
+    return LIQUID_OK;
+}
+
 // apply additive white Gausss noise impairment
 //  _q           : channel object
 //  _noise_floor : noise floor power spectral density
@@ -274,7 +297,8 @@ int CHANNEL(_execute)(CHANNEL() _q,
     if (_q->enabled_shadowing) {
         // TODO: use type-specific value other than float
         float g = 0;
-        IIRFILT(_execute)(_q->shadowing_filter, randnf()*_q->shadowing_std, &g);
+        float v = _q->rng == NULL ? randnf() : liquid_rng_randnf(_q->rng);
+        IIRFILT(_execute)(_q->shadowing_filter, v*_q->shadowing_std, &g);
         g /= _q->shadowing_fd * 6.9f;
         g = powf(10.0f, g/20.0f);
         r *= g;
@@ -289,7 +313,11 @@ int CHANNEL(_execute)(CHANNEL() _q,
     // apply AWGN if enabled
     if (_q->enabled_awgn) {
         r *= _q->gamma;
-        r += _q->nstd * ( randnf() + _Complex_I*randnf() ) * M_SQRT1_2;
+        if (_q->rng == NULL) {
+            r += _q->nstd * ( randnf() + _Complex_I*randnf() ) * M_SQRT1_2;
+        } else {
+            liquid_rng_cawgn(_q->rng, &r, _q->nstd);
+        }
     }
 
     // set output value
@@ -297,7 +325,14 @@ int CHANNEL(_execute)(CHANNEL() _q,
     return LIQUID_OK;
 }
 
-// apply channel impairments on single input sample
+// apply channel impairments on block of samples, running each stage over
+// the whole block: multi-path filter, shadowing from a block of Gauss
+// samples, carrier offset with the block mixer, and gain followed by bulk
+// noise. The filter and oscillator states carry over between calls
+// exactly as with execute(). With a generator set, noise and shadowing
+// are drawn with its ziggurat block methods so their realization differs
+// from that of execute() and depends on how the input is split into
+// blocks; without one they are drawn from rand() as in execute().
 //  _q      : channel object
 //  _x      : input array [size: _n x 1]
 //  _n      : input array length
@@ -307,11 +342,50 @@ int CHANNEL(_execute_block)(CHANNEL()    _q,
                             unsigned int _n,
                             TO *         _y)
 {
-    // apply channel effects on each input sample
-    // TODO: apply in blocks
     unsigned int i;
-    for (i=0; i<_n; i++)
-        CHANNEL(_execute)(_q, _x[i], &_y[i]);
+
+    // apply filter
+    if (_q->enabled_multipath) {
+        FIRFILT(_execute_block)(_q->channel_filter, _x, _n, _y);
+    } else if (_y != _x) {
+        memmove(_y, _x, _n*sizeof(TO));
+    }
+
+    // apply shadowing if enabled, processing gain in chunks
+    if (_q->enabled_shadowing) {
+        float g[CHANNEL_SHADOWING_BLOCK];
+        float scale = 1.0f / (_q->shadowing_fd * 6.9f * 20.0f);
+        unsigned int n0;
+        for (n0=0; n0<_n; n0+=CHANNEL_SHADOWING_BLOCK) {
+            unsigned int n1 = _n - n0 < CHANNEL_SHADOWING_BLOCK ? _n - n0 : CHANNEL_SHADOWING_BLOCK;
+            if (_q->rng == NULL) {
+                for (i=0; i<n1; i++)
+                    g[i] = randnf();
+            } else {
+                liquid_rng_randnf_block(_q->rng, g, n1);
+            }
+            for (i=0; i<n1; i++)
+                g[i] *= _q->shadowing_std;
+            IIRFILT(_execute_block)(_q->shadowing_filter, g, n1, g);
+            for (i=0; i<n1; i++)
+                _y[n0+i] *= powf(10.0f, g[i]*scale);
+        }
+    }
+
+    // apply carrier if enabled
+    if (_q->enabled_carrier)
+        NCO(_mix_block_up)(_q->nco, _y, _y, _n);
+
+    // apply AWGN if enabled
+    if (_q->enabled_awgn) {
+        for (i=0; i<_n; i++)
+            _y[i] *= _q->gamma;
+        if (_q->rng == NULL) {
+            for (i=0; i<_n; i++)
+                _y[i] += _q->nstd * ( randnf() + _Complex_I*randnf() ) * M_SQRT1_2;
+        } else {
+            liquid_rng_cawgn_block(_q->rng, _y, _n, _q->nstd);
+        }
+    }
     return LIQUID_OK;
 }
-
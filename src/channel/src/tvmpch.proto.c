@@ -40,6 +40,18 @@ struct TVMPCH(_s) {
     float std;
     float alpha;
     float beta;
+
+    // block tap updates: taps are drawn every 'interval' samples with the
+    // equivalent multi-step random walk and interpolated linearly between
+    unsigned int interval;  // update interval [samples]
+    unsigned int counter;   // samples since last update
+    float alpha_m;          // random walk feedback over interval
+    float std_m;            // random walk innovation over interval
+    TC * h1;                // taps at end of current interval
+    TC * dh;                // per-sample tap increment
+
+    // random number generator (NULL to use rand())
+    liquid_rng rng;
 };
 
 // create time-varying multi-path channel emulator object
@@ -65,6 +77,9 @@ TVMPCH() TVMPCH(_create)(unsigned int _n,
     q->beta  = _tau;
     q->std   = 2.0f * _std / sqrtf(q->beta);
     q->alpha = 1.0f - q->beta;
+    q->rng   = NULL;
+    q->h1    = (TC *) malloc((q->h_len)*sizeof(TC));
+    q->dh    = (TC *) malloc((q->h_len)*sizeof(TC));
 
     // time-reverse coefficients
     unsigned int i;
@@ -75,6 +90,9 @@ TVMPCH() TVMPCH(_create)(unsigned int _n,
     // create window (internal buffer)
     q->w = WINDOW(_create)(q->h_len);
 
+    // update taps on every sample
+    TVMPCH(_set_update_interval)(q, 1);
+
     // reset filter state (clear buffer)
     TVMPCH(_reset)(q);
 
@@ -96,10 +114,16 @@ TVMPCH() TVMPCH(_copy)(TVMPCH() q_orig)
     // copy channel filter coefficients
     q_copy->h = (TC*) malloc(q_copy->h_len*sizeof(TC));
     memmove(q_copy->h, q_orig->h, q_copy->h_len*sizeof(TC));
+    q_copy->h1 = (TC*) liquid_malloc_copy(q_orig->h1, q_orig->h_len, sizeof(TC));
+    q_copy->dh = (TC*) liquid_malloc_copy(q_orig->dh, q_orig->h_len, sizeof(TC));
 
     // copying window object
     q_copy->w = WINDOW(_copy)(q_orig->w);
 
+    // copy random number generator, including its state
+    if (q_orig->rng != NULL)
+        q_copy->rng = liquid_rng_copy(q_orig->rng);
+
     return q_copy;
 }
 
@@ -107,7 +131,11 @@ TVMPCH() TVMPCH(_copy)(TVMPCH() q_orig)
 int TVMPCH(_destroy)(TVMPCH() _q)
 {
     WINDOW(_destroy)(_q->w);
+    if (_q->rng != NULL)
+        liquid_rng_destroy(_q->rng);
     free(_q->h);
+    free(_q->h1);
+    free(_q->dh);
     free(_q);
     return LIQUID_OK;
 }
@@ -133,6 +161,71 @@ int TVMPCH(_print)(TVMPCH() _q)
     return LIQUID_OK;
 }
 
+// set random number generator (copied), or NULL to use rand()
+int TVMPCH(_set_rng)(TVMPCH()   _q,
+                     liquid_rng _rng)
+{
+    if (_q->rng != NULL)
+        liquid_rng_destroy(_q->rng);
+    _q->rng = _rng == NULL ? NULL : liquid_rng_copy(_rng);
+    return LIQUID_OK;
+}
+
+// set interval at which taps are updated; taps are interpolated linearly
+// between updates
+int TVMPCH(_set_update_interval)(TVMPCH()     _q,
+                                 unsigned int _interval)
+{
+    if (_interval == 0)
+        return liquid_error(LIQUID_EICONFIG,"tvmpch_%s_set_update_interval(), interval must be greater than zero", EXTENSION_FULL);
+
+    // random walk h <- alpha*h + beta*w applied _interval times
+    _q->interval = _interval;
+    _q->counter  = 0;
+    _q->alpha_m  = powf(_q->alpha, (float)_interval);
+    float g = _q->alpha < 1.0f ?
+        (1.0f - _q->alpha_m*_q->alpha_m) / (1.0f - _q->alpha*_q->alpha) :
+        (float)_interval;
+    _q->std_m = _q->beta * _q->std * sqrtf(g);
+
+    // start from current taps with no increment
+    memmove(_q->h1, _q->h, _q->h_len*sizeof(TC));
+    memset(_q->dh, 0x00, _q->h_len*sizeof(TC));
+    return LIQUID_OK;
+}
+
+// get interval at which taps are updated
+unsigned int TVMPCH(_get_update_interval)(TVMPCH() _q)
+{
+    return _q->interval;
+}
+
+// update taps for block mode: draw new end point at start of each
+// interval, then step taps towards it
+static void TVMPCH(_update_block)(TVMPCH() _q)
+{
+    unsigned int i;
+    unsigned int n = _q->h_len - 1;
+    if (_q->counter == 0) {
+        // start from previous end point exactly to avoid drift
+        memmove(_q->h, _q->h1, n*sizeof(TC));
+        float g = 1.0f / (float)_q->interval;
+        for (i=0; i<n; i++) {
+            TC v;
+            if (_q->rng == NULL) {
+                v = randnf() + _Complex_I*randnf();
+            } else {
+                liquid_rng_crandnf(_q->rng, &v);
+            }
+            _q->h1[i] = _q->alpha_m*_q->h1[i] + v * _q->std_m * M_SQRT1_2;
+            _q->dh[i] = (_q->h1[i] - _q->h[i]) * g;
+        }
+    }
+    for (i=0; i<n; i++)
+        _q->h[i] += _q->dh[i];
+    _q->counter = (_q->counter + 1) % _q->interval;
+}
+
 // push sample into filter object's internal buffer
 //  _q      :   filter object
 //  _x      :   input sample
@@ -141,8 +234,18 @@ int TVMPCH(_push)(TVMPCH() _q,
 {
     // update coefficients
     unsigned int i;
-    for (i=0; i<_q->h_len-1; i++)
-        _q->h[i] = _q->alpha*_q->h[i] + _q->beta*(randnf() + _Complex_I*randnf()) * _q->std * M_SQRT1_2;
+    if (_q->interval > 1) {
+        TVMPCH(_update_block)(_q);
+    } else if (_q->rng == NULL) {
+        for (i=0; i<_q->h_len-1; i++)
+            _q->h[i] = _q->alpha*_q->h[i] + _q->beta*(randnf() + _Complex_I*randnf()) * _q->std * M_SQRT1_2;
+    } else {
+        for (i=0; i<_q->h_len-1; i++) {
+            float complex v;
+            liquid_rng_crandnf(_q->rng, &v);
+            _q->h[i] = _q->alpha*_q->h[i] + _q->beta*v * _q->std * M_SQRT1_2;
+        }
+    }
 
     // push sample into window buffer
     WINDOW(_push)(_q->w, _x);
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2007 - 2025 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "autotest/autotest.h"
+#include "liquid.h"
+
+// block execution of deterministic stages (multi-path, carrier) matches
+// sample-by-sample execution, including across uneven block boundaries
+void autotest_channel_cccf_execute_block()
+{
+    unsigned int i, n = 1000;
+    float complex x[1000], y0[1000], y1[1000];
+    for (i=0; i<n; i++)
+        x[i] = cexpf(_Complex_I*0.1f*i*i) * (1.0f + 0.3f*cosf(0.01f*i));
+
+    channel_cccf q0 = channel_cccf_create();
+    channel_cccf_add_carrier_offset(q0, 0.07f, 0.3f);
+    channel_cccf_add_multipath     (q0, NULL, 11);
+    channel_cccf q1 = channel_cccf_copy(q0);
+
+    for (i=0; i<n; i++)
+        channel_cccf_execute(q0, x[i], &y0[i]);
+
+    // run in blocks of varying size, in place
+    memmove(y1, x, sizeof(x));
+    unsigned int n0 = 0, b = 1;
+    while (n0 < n) {
+        unsigned int n1 = n - n0 < b ? n - n0 : b;
+        channel_cccf_execute_block(q1, y1+n0, n1, y1+n0);
+        n0 += n1;
+        b = 2*b + 1;
+    }
+    for (i=0; i<n; i++)
+        CONTEND_DELTA(cabsf(y0[i]-y1[i]), 0.0f, 1e-6f);
+
+    channel_cccf_destroy(q0);
+    channel_cccf_destroy(q1);
+}
+
+// noise added in blocks has the expected power and is reproducible with
+// a counter-based generator
+void autotest_channel_cccf_execute_block_awgn()
+{
+    unsigned int i, n = 40000;
+    float complex * x  = (float complex*) malloc(n*sizeof(float complex));
+    float complex * y0 = (float complex*) malloc(n*sizeof(float complex));
+    float complex * y1 = (float complex*) malloc(n*sizeof(float complex));
+    for (i=0; i<n; i++)
+        x[i] = (i % 2) ? 1.0f : -1.0f;
+
+    // gain 10^((snr+noise_floor)/20) = 1, noise std 10^(noise_floor/20)
+    float noise_floor = -20.0f, snr = 20.0f;
+    liquid_rng rng = liquid_rng_create_counter(3, 0);
+    channel_cccf q0 = channel_cccf_create();
+    channel_cccf_add_awgn    (q0, noise_floor, snr);
+    channel_cccf_add_shadowing(q0, 1.0f, 0.1f);
+    channel_cccf_set_rng     (q0, rng);
+    channel_cccf q1 = channel_cccf_copy(q0);
+
+    channel_cccf_execute_block(q0, x, n, y0);
+    channel_cccf_execute_block(q1, x, n, y1);
+    CONTEND_SAME_DATA(y0, y1, n*sizeof(float complex));
+
+    // without shadowing, noise variance follows noise floor
+    channel_cccf q2 = channel_cccf_create();
+    channel_cccf_add_awgn(q2, noise_floor, snr);
+    channel_cccf_execute_block(q2, x, n, y0);
+    float m = 0.0f, v = 0.0f;
+    for (i=0; i<n; i++) {
+        float complex e = y0[i] - x[i];
+        m += crealf(e) + cimagf(e);
+        v += crealf(e*conjf(e));
+    }
+    CONTEND_DELTA(m/n, 0.0f, 0.005f);
+    CONTEND_DELTA(v/n, powf(10.0f, noise_floor/10.0f), 0.001f);
+
+    liquid_rng_destroy(rng);
+    channel_cccf_destroy(q0);
+    channel_cccf_destroy(q1);
+    channel_cccf_destroy(q2);
+    free(x);
+    free(y0);
+    free(y1);
+}
+
+// without a generator, block noise is drawn from rand() in the same order
+// as execute() so srand() reproduces sample-by-sample output
+void autotest_channel_cccf_execute_block_rand()
+{
+    unsigned int i, n = 400;
+    float complex x[400], y0[400], y1[400];
+    for (i=0; i<n; i++)
+        x[i] = cexpf(_Complex_I*0.3f*i);
+
+    channel_cccf q0 = channel_cccf_create();
+    channel_cccf_add_awgn(q0, -20.0f, 20.0f);
+    channel_cccf q1 = channel_cccf_copy(q0);
+
+    srand(1);
+    for (i=0; i<n; i++)
+        channel_cccf_execute(q0, x[i], &y0[i]);
+    srand(1);
+    channel_cccf_execute_block(q1, x, n, y1);
+    for (i=0; i<n; i++)
+        CONTEND_DELTA(cabsf(y0[i]-y1[i]), 0.0f, 1e-6f);
+
+    channel_cccf_destroy(q0);
+    channel_cccf_destroy(q1);
+}
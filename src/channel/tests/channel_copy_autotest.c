@@ -25,9 +25,8 @@
 #include "autotest/autotest.h"
 #include "liquid.h"
 
-// NOTE: this will never pass since the random sources are different; need to
-//       implement random number generator first
-void xautotest_channel_copy()
+// copy includes internal random number generator and its state
+void autotest_channel_copy()
 {
     // create default channel object and set properties
     channel_cccf q0 = channel_cccf_create();
@@ -35,6 +34,9 @@ void xautotest_channel_copy()
     channel_cccf_add_carrier_offset(q0, 1e-5f, 1.2f);
     channel_cccf_add_multipath     (q0, NULL, 21);
     channel_cccf_add_shadowing     (q0, 1.0f, 0.1f);
+    liquid_rng rng = liquid_rng_create_counter(1, 2);
+    channel_cccf_set_rng           (q0, rng);
+    liquid_rng_destroy(rng);
     channel_cccf_print(q0);
 
     // run samples through original object
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2007 - 2025 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+#include "autotest/autotest.h"
+#include "liquid.h"
+
+// helper: average output power for unit-power input
+float testbench_tvmpch_cccf_power(unsigned int _interval)
+{
+    unsigned int i, n = 80000;
+    liquid_rng rng = liquid_rng_create_counter(17, _interval);
+    tvmpch_cccf q = tvmpch_cccf_create(11, 0.1f, 0.05f);
+    tvmpch_cccf_set_rng(q, rng);
+    tvmpch_cccf_set_update_interval(q, _interval);
+    CONTEND_EQUALITY(tvmpch_cccf_get_update_interval(q), _interval);
+
+    float complex x, y;
+    float p = 0.0f;
+    for (i=0; i<n; i++) {
+        liquid_rng_crandnf(rng, &x);
+        x *= M_SQRT1_2;
+        tvmpch_cccf_execute_one(q, x, &y);
+        p += crealf(y*conjf(y));
+    }
+    tvmpch_cccf_destroy(q);
+    liquid_rng_destroy(rng);
+    return p / (float)n;
+}
+
+// per-sample and interpolated tap updates give the same average channel
+// power, 1 + (n-1)*4*std^2/(2-tau), for intervals well below the coherence
+// time (interpolation slightly lowers the power between updates)
+void autotest_tvmpch_cccf_update_interval()
+{
+    float p_ref = 1.0f + 10*4*0.1f*0.1f/(2.0f-0.05f);
+    float p1  = testbench_tvmpch_cccf_power( 1);
+    float p2  = testbench_tvmpch_cccf_power( 2);
+    float p4  = testbench_tvmpch_cccf_power( 4);
+    CONTEND_DELTA(p1,  p_ref, 0.05f);
+    CONTEND_DELTA(p2,  p_ref, 0.05f);
+    CONTEND_DELTA(p4,  p_ref, 0.05f);
+}
+
+// interpolated taps evolve identically regardless of block partitioning
+void autotest_tvmpch_cccf_execute_block()
+{
+    unsigned int i, n = 500;
+    float complex x[500], y0[500], y1[500];
+    for (i=0; i<n; i++)
+        x[i] = cexpf(_Complex_I*0.37f*i);
+
+    liquid_rng rng = liquid_rng_create_counter(4, 0);
+    tvmpch_cccf q0 = tvmpch_cccf_create(7, 0.2f, 0.1f);
+    tvmpch_cccf_set_rng(q0, rng);
+    tvmpch_cccf_set_update_interval(q0, 8);
+    tvmpch_cccf q1 = tvmpch_cccf_copy(q0);
+
+    tvmpch_cccf_execute_block(q0, x, n, y0);
+    tvmpch_cccf_execute_block(q1, x,       123,   y1);
+    tvmpch_cccf_execute_block(q1, x+123, n-123,   y1+123);
+    CONTEND_SAME_DATA(y0, y1, sizeof(y0));
+
+    tvmpch_cccf_destroy(q0);
+    tvmpch_cccf_destroy(q1);
+    liquid_rng_destroy(rng);
+}
+
+// invalid update interval
+void autotest_tvmpch_cccf_config()
+{
+#if LIQUID_STRICT_EXIT
+    AUTOTEST_WARN("skipping tvmpch config test with strict exit enabled\n");
+    return;
+#endif
+#if !LIQUID_SUPPRESS_ERROR_OUTPUT
+    fprintf(stderr,"warning: ignore potential errors here; checking for invalid configurations\n");
+#endif
+    tvmpch_cccf q = tvmpch_cccf_create(7, 0.2f, 0.1f);
+    CONTEND_INEQUALITY(tvmpch_cccf_set_update_interval(q, 0), LIQUID_OK);
+    CONTEND_EQUALITY  (tvmpch_cccf_get_update_interval(q), 1);
+    tvmpch_cccf_destroy(q);
+}
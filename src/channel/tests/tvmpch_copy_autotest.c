@@ -25,12 +25,14 @@
 #include "autotest/autotest.h"
 #include "liquid.h"
 
-// NOTE: this will never pass since the random sources are different; need to
-//       implement random number generator first
-void xautotest_tvmpch_copy()
+// copy includes internal random number generator and its state
+void autotest_tvmpch_copy()
 {
     // create default channel object and set properties
     tvmpch_cccf q0 = tvmpch_cccf_create(31, 0.1f, 0.05f);
+    liquid_rng rng = liquid_rng_create_counter(1, 2);
+    tvmpch_cccf_set_rng(q0, rng);
+    liquid_rng_destroy(rng);
 
     // run samples through original object
     unsigned int i;
@@ -94,13 +94,37 @@ int DOTPROD(_run4)(TC *         _h,
 // structured dot product
 //
 
+// test whether object was built from coefficients _h (see liquid_shared_acquire)
+static int DOTPROD(_match)(const void * _obj,
+                           const void * _h,
+                           unsigned int _n,
+                           int          _rev)
+{
+    DOTPROD()  q = (DOTPROD()) _obj;
+    const TC * h = (const TC *) _h;
+    if (q->n != _n)
+        return 0;
+    unsigned int i;
+    for (i=0; i<_n; i++) {
+        if (q->h[i] != h[_rev ? _n-i-1 : i])
+            return 0;
+    }
+    return 1;
+}
+
 // create vector dot product object
 //  _h      :   coefficients array [size: 1 x _n]
 //  _n      :   dot product length
 DOTPROD() DOTPROD(_create)(TC *         _h,
                            unsigned int _n)
 {
-    DOTPROD() q = (DOTPROD()) malloc(sizeof(struct DOTPROD(_s)));
+    // share existing object created from identical coefficients
+    uint32_t hash = liquid_shared_hash(_h, _n*sizeof(TC), 0);
+    DOTPROD() q = (DOTPROD()) liquid_shared_acquire(DOTPROD(_match), hash, _h, _n, 0);
+    if (q != NULL)
+        return q;
+
+    q = (DOTPROD()) liquid_shared_alloc(sizeof(struct DOTPROD(_s)));
     q->n = _n;
 
     // allocate memory for coefficients
@@ -109,6 +133,9 @@ DOTPROD() DOTPROD(_create)(TC *         _h,
     // move coefficients
     memmove(q->h, _h, (q->n)*sizeof(TC));
 
+    // register object for sharing
+    liquid_shared_insert(q, DOTPROD(_match), hash, 0);
+
     // return object
     return q;
 }
@@ -119,7 +146,13 @@ DOTPROD() DOTPROD(_create)(TC *         _h,
 DOTPROD() DOTPROD(_create_rev)(TC *         _h,
                                unsigned int _n)
 {
-    DOTPROD() q = (DOTPROD()) malloc(sizeof(struct DOTPROD(_s)));
+    // share existing object created from identical coefficients
+    uint32_t hash = liquid_shared_hash(_h, _n*sizeof(TC), 1);
+    DOTPROD() q = (DOTPROD()) liquid_shared_acquire(DOTPROD(_match), hash, _h, _n, 1);
+    if (q != NULL)
+        return q;
+
+    q = (DOTPROD()) liquid_shared_alloc(sizeof(struct DOTPROD(_s)));
     q->n = _n;
 
     // allocate memory for coefficients
@@ -130,6 +163,9 @@ DOTPROD() DOTPROD(_create_rev)(TC *         _h,
     for (i=0; i<_n; i++)
         q->h[i] = _h[_n-i-1];
 
+    // register object for sharing
+    liquid_shared_insert(q, DOTPROD(_match), hash, 1);
+
     // return object
     return q;
 }
@@ -142,6 +178,12 @@ DOTPROD() DOTPROD(_recreate)(DOTPROD()    _q,
                              TC *         _h,
                              unsigned int _n)
 {
+    // coefficients are shared with another object; detach (copy-on-write)
+    if (!liquid_shared_detach(_q)) {
+        DOTPROD(_destroy)(_q);
+        return DOTPROD(_create)(_h, _n);
+    }
+
     // check to see if length has changed
     if (_q->n != _n) {
         // set new length
@@ -154,7 +196,8 @@ DOTPROD() DOTPROD(_recreate)(DOTPROD()    _q,
     // move new coefficients
     memmove(_q->h, _h, (_q->n)*sizeof(TC));
 
-    // return re-structured object
+    // register re-structured object for sharing and return
+    liquid_shared_insert(_q, DOTPROD(_match), liquid_shared_hash(_h, _n*sizeof(TC), 0), 0);
     return _q;
 }
 
@@ -166,6 +209,12 @@ DOTPROD() DOTPROD(_recreate_rev)(DOTPROD()    _q,
                                  TC *         _h,
                                  unsigned int _n)
 {
+    // coefficients are shared with another object; detach (copy-on-write)
+    if (!liquid_shared_detach(_q)) {
+        DOTPROD(_destroy)(_q);
+        return DOTPROD(_create_rev)(_h, _n);
+    }
+
     // check to see if length has changed
     if (_q->n != _n) {
         // set new length
@@ -180,7 +229,8 @@ DOTPROD() DOTPROD(_recreate_rev)(DOTPROD()    _q,
     for (i=0; i<_n; i++)
         _q->h[i] = _h[_n-i-1];
 
-    // return re-structured object
+    // register re-structured object for sharing and return
+    liquid_shared_insert(_q, DOTPROD(_match), liquid_shared_hash(_h, _n*sizeof(TC), 1), 1);
     return _q;
 }
 
@@ -189,25 +239,22 @@ DOTPROD() DOTPROD(_copy)(DOTPROD() q_orig)
 {
     // validate input
     if (q_orig == NULL)
-        return liquid_error_config("dotprod_%s_copy(), window object cannot be NULL", "xxxt");
-
-    // create new base object and copy parameters
-    DOTPROD() q_copy = (DOTPROD()) malloc(sizeof(struct DOTPROD(_s)));
-    q_copy->n = q_orig->n;
+        return liquid_error_config("dotprod_%s_copy(), window object cannot be NULL", EXTENSION_FULL);
 
-    // allocate memory and copy coefficients
-    q_copy->h = (TC*) malloc((q_copy->n)*sizeof(TC));
-    memmove(q_copy->h, q_orig->h, (q_copy->n)*sizeof(TC));
-
-    // return new object
-    return q_copy;
+    // coefficients are immutable; share them and increment reference count
+    liquid_shared_retain(q_orig);
+    return q_orig;
 }
 
 // destroy dot product object
 int DOTPROD(_destroy)(DOTPROD() _q)
 {
+    // release coefficients only once the last reference is gone
+    if (liquid_shared_release(_q) > 0)
+        return LIQUID_OK;
+
     free(_q->h);    // free coefficients memory
-    free(_q);       // free main object memory
+    liquid_shared_dealloc(_q);  // free main object memory
     return LIQUID_OK;
 }
 
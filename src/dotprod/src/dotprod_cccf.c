@@ -28,6 +28,7 @@
 #include "liquid.internal.h"
 
 #define DOTPROD(name)   LIQUID_CONCAT(dotprod_cccf,name)
+#define EXTENSION_FULL  "cccf"
 #define TO              float complex
 #define TC              float complex
 #define TI              float complex
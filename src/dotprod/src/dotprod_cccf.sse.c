@@ -95,11 +95,36 @@ struct dotprod_cccf_s {
     float * hq;         // quadrature
 };
 
+// test whether object was built from coefficients _h (see liquid_shared_acquire)
+static int dotprod_cccf_match(const void * _obj,
+                              const void * _h,
+                              unsigned int _n,
+                              int          _rev)
+{
+    dotprod_cccf q = (dotprod_cccf) _obj;
+    const float complex * h = (const float complex *) _h;
+    if (q->n != _n)
+        return 0;
+    unsigned int i;
+    for (i=0; i<_n; i++) {
+        unsigned int k = _rev ? _n-i-1 : i;
+        if (q->hi[2*i] != crealf(h[k]) || q->hq[2*i] != cimagf(h[k]))
+            return 0;
+    }
+    return 1;
+}
+
 dotprod_cccf dotprod_cccf_create_opt(float complex * _h,
                                      unsigned int    _n,
                                      int             _rev)
 {
-    dotprod_cccf q = (dotprod_cccf)malloc(sizeof(struct dotprod_cccf_s));
+    // share existing object created from identical coefficients
+    uint32_t hash = liquid_shared_hash(_h, _n*sizeof(float complex), _rev);
+    dotprod_cccf q = (dotprod_cccf) liquid_shared_acquire(dotprod_cccf_match, hash, _h, _n, _rev);
+    if (q != NULL)
+        return q;
+
+    q = (dotprod_cccf) liquid_shared_alloc(sizeof(struct dotprod_cccf_s));
     q->n = _n;
 
     // allocate memory for coefficients, 16-byte aligned
@@ -119,6 +144,9 @@ dotprod_cccf dotprod_cccf_create_opt(float complex * _h,
         q->hq[2*i+1] = cimagf(_h[k]);
     }
 
+    // register object for sharing
+    liquid_shared_insert(q, dotprod_cccf_match, hash, _rev);
+
     // return object
     return q;
 }
@@ -161,28 +189,20 @@ dotprod_cccf dotprod_cccf_copy(dotprod_cccf q_orig)
     if (q_orig == NULL)
         return liquid_error_config("dotprod_cccf_copy().sse, object cannot be NULL");
 
-    dotprod_cccf q_copy = (dotprod_cccf)malloc(sizeof(struct dotprod_cccf_s));
-    q_copy->n = q_orig->n;
-
-    // allocate memory for coefficients, 16-byte aligned (repeated)
-    q_copy->hi = (float*) _mm_malloc( 2*q_copy->n*sizeof(float), 16 );
-    q_copy->hq = (float*) _mm_malloc( 2*q_copy->n*sizeof(float), 16 );
-
-    // copy coefficients array (repeated)
-    //  hi = { crealf(_h[0]), crealf(_h[0]), ... crealf(_h[n-1]), crealf(_h[n-1])}
-    //  hq = { cimagf(_h[0]), cimagf(_h[0]), ... cimagf(_h[n-1]), cimagf(_h[n-1])}
-    memmove(q_copy->hi, q_orig->hi, 2*q_orig->n*sizeof(float));
-    memmove(q_copy->hq, q_orig->hq, 2*q_orig->n*sizeof(float));
-
-    // return object
-    return q_copy;
+    // coefficients are immutable; share them and increment reference count
+    liquid_shared_retain(q_orig);
+    return q_orig;
 }
 
 int dotprod_cccf_destroy(dotprod_cccf _q)
 {
+    // release coefficients only once the last reference is gone
+    if (liquid_shared_release(_q) > 0)
+        return LIQUID_OK;
+
     _mm_free(_q->hi);
     _mm_free(_q->hq);
-    free(_q);
+    liquid_shared_dealloc(_q);
     return LIQUID_OK;
 }
 
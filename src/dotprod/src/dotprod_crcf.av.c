@@ -99,12 +99,37 @@ struct dotprod_crcf_s {
     float *h[4];
 };
 
+// test whether object was built from coefficients _h (see liquid_shared_acquire)
+static int dotprod_crcf_match(const void * _obj,
+                              const void * _h,
+                              unsigned int _n,
+                              int          _rev)
+{
+    dotprod_crcf q = (dotprod_crcf) _obj;
+    const float * h = (const float *) _h;
+    if (q->n != _n)
+        return 0;
+    unsigned int i;
+    for (i=0; i<_n; i++) {
+        unsigned int k = _rev ? _n-i-1 : i;
+        if (q->h[0][2*i] != h[k])
+            return 0;
+    }
+    return 1;
+}
+
 // create the structured dotprod object
 dotprod_crcf dotprod_crcf_create_opt(float *      _h,
                                      unsigned int _n,
                                      int          _rev)
 {
-    dotprod_crcf q = (dotprod_crcf)malloc(sizeof(struct dotprod_crcf_s));
+    // share existing object created from identical coefficients
+    uint32_t hash = liquid_shared_hash(_h, _n*sizeof(float), _rev);
+    dotprod_crcf q = (dotprod_crcf) liquid_shared_acquire(dotprod_crcf_match, hash, _h, _n, _rev);
+    if (q != NULL)
+        return q;
+
+    q = (dotprod_crcf) liquid_shared_alloc(sizeof(struct dotprod_crcf_s));
     q->n = _n;
 
     // create 4 copies of the input coefficients (one for each
@@ -125,6 +150,9 @@ dotprod_crcf dotprod_crcf_create_opt(float *      _h,
         }
     }
 
+    // register object for sharing
+    liquid_shared_insert(q, dotprod_crcf_match, hash, _rev);
+
     return q;
 }
 
@@ -163,13 +191,17 @@ dotprod_crcf dotprod_crcf_recreate_rev(dotprod_crcf _q,
 // destroy the structured dotprod object
 int dotprod_crcf_destroy(dotprod_crcf _q)
 {
+    // release coefficients only once the last reference is gone
+    if (liquid_shared_release(_q) > 0)
+        return LIQUID_OK;
+
     // clean up coefficients arrays
     unsigned int i;
     for (i=0; i<4; i++)
         free(_q->h[i]);
 
     // free allocated object memory
-    free(_q);
+    liquid_shared_dealloc(_q);
     return LIQUID_OK;
 }
 
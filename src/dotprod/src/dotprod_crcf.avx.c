@@ -93,11 +93,36 @@ struct dotprod_crcf_s {
     float * h;          // coefficients array
 };
 
+// test whether object was built from coefficients _h (see liquid_shared_acquire)
+static int dotprod_crcf_match(const void * _obj,
+                              const void * _h,
+                              unsigned int _n,
+                              int          _rev)
+{
+    dotprod_crcf q = (dotprod_crcf) _obj;
+    const float * h = (const float *) _h;
+    if (q->n != _n)
+        return 0;
+    unsigned int i;
+    for (i=0; i<_n; i++) {
+        unsigned int k = _rev ? _n-i-1 : i;
+        if (q->h[2*i] != h[k])
+            return 0;
+    }
+    return 1;
+}
+
 dotprod_crcf dotprod_crcf_create_opt(float *      _h,
                                      unsigned int _n,
                                      int          _rev)
 {
-    dotprod_crcf q = (dotprod_crcf)malloc(sizeof(struct dotprod_crcf_s));
+    // share existing object created from identical coefficients
+    uint32_t hash = liquid_shared_hash(_h, _n*sizeof(float), _rev);
+    dotprod_crcf q = (dotprod_crcf) liquid_shared_acquire(dotprod_crcf_match, hash, _h, _n, _rev);
+    if (q != NULL)
+        return q;
+
+    q = (dotprod_crcf) liquid_shared_alloc(sizeof(struct dotprod_crcf_s));
     q->n = _n;
 
     // allocate memory for coefficients, 32-byte aligned
@@ -112,6 +137,9 @@ dotprod_crcf dotprod_crcf_create_opt(float *      _h,
         q->h[2*i+1] = _h[k];
     }
 
+    // register object for sharing
+    liquid_shared_insert(q, dotprod_crcf_match, hash, _rev);
+
     // return object
     return q;
 }
@@ -154,25 +182,20 @@ dotprod_crcf dotprod_crcf_copy(dotprod_crcf q_orig)
     if (q_orig == NULL)
         return liquid_error_config("dotprod_crcf_copy().avx, object cannot be NULL");
 
-    dotprod_crcf q_copy = (dotprod_crcf)malloc(sizeof(struct dotprod_crcf_s));
-    q_copy->n = q_orig->n;
-
-    // allocate memory for coefficients, 32-byte aligned (repeated)
-    q_copy->h = (float*) _mm_malloc( 2*q_copy->n*sizeof(float), 32 );
-
-    // copy coefficients array (repeated)
-    //  h = { _h[0], _h[0], _h[1], _h[1], ... _h[n-1], _h[n-1]}
-    memmove(q_copy->h, q_orig->h, 2*q_orig->n*sizeof(float));
-
-    // return object
-    return q_copy;
+    // coefficients are immutable; share them and increment reference count
+    liquid_shared_retain(q_orig);
+    return q_orig;
 }
 
 
 int dotprod_crcf_destroy(dotprod_crcf _q)
 {
+    // release coefficients only once the last reference is gone
+    if (liquid_shared_release(_q) > 0)
+        return LIQUID_OK;
+
     _mm_free(_q->h);
-    free(_q);
+    liquid_shared_dealloc(_q);
     return LIQUID_OK;
 }
 
@@ -28,6 +28,7 @@
 #include "liquid.internal.h"
 
 #define DOTPROD(name)   LIQUID_CONCAT(dotprod_crcf,name)
+#define EXTENSION_FULL  "crcf"
 #define TO              float complex
 #define TC              float
 #define TI              float complex
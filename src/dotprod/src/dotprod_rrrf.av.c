@@ -99,12 +99,37 @@ struct dotprod_rrrf_s {
     float *h[4];
 };
 
+// test whether object was built from coefficients _h (see liquid_shared_acquire)
+static int dotprod_rrrf_match(const void * _obj,
+                              const void * _h,
+                              unsigned int _n,
+                              int          _rev)
+{
+    dotprod_rrrf q = (dotprod_rrrf) _obj;
+    const float * h = (const float *) _h;
+    if (q->n != _n)
+        return 0;
+    unsigned int i;
+    for (i=0; i<_n; i++) {
+        unsigned int k = _rev ? _n-i-1 : i;
+        if (q->h[0][i] != h[k])
+            return 0;
+    }
+    return 1;
+}
+
 // create the structured dotprod object
 dotprod_rrrf dotprod_rrrf_create_opt(float *      _h,
                                      unsigned int _n,
                                      int          _rev)
 {
-    dotprod_rrrf q = (dotprod_rrrf)malloc(sizeof(struct dotprod_rrrf_s));
+    // share existing object created from identical coefficients
+    uint32_t hash = liquid_shared_hash(_h, _n*sizeof(float), _rev);
+    dotprod_rrrf q = (dotprod_rrrf) liquid_shared_acquire(dotprod_rrrf_match, hash, _h, _n, _rev);
+    if (q != NULL)
+        return q;
+
+    q = (dotprod_rrrf) liquid_shared_alloc(sizeof(struct dotprod_rrrf_s));
     q->n = _n;
 
     // create 4 copies of the input coefficients (one for each
@@ -120,6 +145,9 @@ dotprod_rrrf dotprod_rrrf_create_opt(float *      _h,
             e->h[i][j+i] = _h[_rev ? q->n-j-1 : j];
     }
 
+    // register object for sharing
+    liquid_shared_insert(q, dotprod_rrrf_match, hash, _rev);
+
     return q;
 }
 
@@ -158,13 +186,17 @@ dotprod_rrrf dotprod_rrrf_recreate_rev(dotprod_rrrf _q,
 // destroy the structured dotprod object
 int dotprod_rrrf_destroy(dotprod_rrrf _q)
 {
+    // release coefficients only once the last reference is gone
+    if (liquid_shared_release(_q) > 0)
+        return LIQUID_OK;
+
     // clean up coefficients arrays
     unsigned int i;
     for (i=0; i<4; i++)
         free(_q->h[i]);
 
     // free allocated object memory
-    free(_q);
+    liquid_shared_dealloc(_q);
     return LIQUID_OK;
 }
 
@@ -98,11 +98,36 @@ struct dotprod_rrrf_s {
     float * h;          // coefficients array
 };
 
+// test whether object was built from coefficients _h (see liquid_shared_acquire)
+static int dotprod_rrrf_match(const void * _obj,
+                              const void * _h,
+                              unsigned int _n,
+                              int          _rev)
+{
+    dotprod_rrrf q = (dotprod_rrrf) _obj;
+    const float * h = (const float *) _h;
+    if (q->n != _n)
+        return 0;
+    unsigned int i;
+    for (i=0; i<_n; i++) {
+        unsigned int k = _rev ? _n-i-1 : i;
+        if (q->h[i] != h[k])
+            return 0;
+    }
+    return 1;
+}
+
 dotprod_rrrf dotprod_rrrf_create_opt(float *      _h,
                                      unsigned int _n,
                                      int          _rev)
 {
-    dotprod_rrrf q = (dotprod_rrrf)malloc(sizeof(struct dotprod_rrrf_s));
+    // share existing object created from identical coefficients
+    uint32_t hash = liquid_shared_hash(_h, _n*sizeof(float), _rev);
+    dotprod_rrrf q = (dotprod_rrrf) liquid_shared_acquire(dotprod_rrrf_match, hash, _h, _n, _rev);
+    if (q != NULL)
+        return q;
+
+    q = (dotprod_rrrf) liquid_shared_alloc(sizeof(struct dotprod_rrrf_s));
     q->n = _n;
 
     // allocate memory for coefficients, 64-byte aligned
@@ -113,6 +138,9 @@ dotprod_rrrf dotprod_rrrf_create_opt(float *      _h,
     for (i=0; i<q->n; i++)
         q->h[i] = _h[_rev ? q->n-i-1 : i];
 
+    // register object for sharing
+    liquid_shared_insert(q, dotprod_rrrf_match, hash, _rev);
+
     // return object
     return q;
 }
@@ -155,23 +183,19 @@ dotprod_rrrf dotprod_rrrf_copy(dotprod_rrrf q_orig)
     if (q_orig == NULL)
         return liquid_error_config("dotprod_rrrf_copy().avx512f, object cannot be NULL");
 
-    dotprod_rrrf q_copy = (dotprod_rrrf)malloc(sizeof(struct dotprod_rrrf_s));
-    q_copy->n = q_orig->n;
-
-    // allocate memory for coefficients, 64-byte aligned
-    q_copy->h = (float*) _mm_malloc( q_copy->n*sizeof(float), 64 );
-
-    // copy coefficients array
-    memmove(q_copy->h, q_orig->h, q_orig->n*sizeof(float));
-
-    // return object
-    return q_copy;
+    // coefficients are immutable; share them and increment reference count
+    liquid_shared_retain(q_orig);
+    return q_orig;
 }
 
 int dotprod_rrrf_destroy(dotprod_rrrf _q)
 {
+    // release coefficients only once the last reference is gone
+    if (liquid_shared_release(_q) > 0)
+        return LIQUID_OK;
+
     _mm_free(_q->h);
-    free(_q);
+    liquid_shared_dealloc(_q);
     return LIQUID_OK;
 }
 
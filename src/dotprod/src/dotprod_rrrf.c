@@ -27,6 +27,7 @@
 #include "liquid.internal.h"
 
 #define DOTPROD(name)   LIQUID_CONCAT(dotprod_rrrf,name)
+#define EXTENSION_FULL  "rrrf"
 #define TO              float
 #define TC              float
 #define TI              float
@@ -403,3 +403,86 @@ void autotest_dotprod_rrrf_struct_vs_ordinal()
         runtest_dotprod_rrrf(i);
 }
 
+
+// copies share coefficients; re-creating one detaches it from the other
+void autotest_dotprod_rrrf_copy_shared()
+{
+    float tol = 1e-6;
+    float h0[8] = { 1, 2, 3, 4, 5, 6, 7, 8};
+    float h1[8] = {-1,-1,-1,-1,-1,-1,-1,-1};
+    float x [8] = { 1, 0, 1, 0, 1, 0, 1, 0};
+    float y0, y1;
+
+    // create object and copies which share its coefficients
+    dotprod_rrrf q0 = dotprod_rrrf_create(h0, 8);
+    dotprod_rrrf q1 = dotprod_rrrf_copy(q0);
+    dotprod_rrrf q2 = dotprod_rrrf_copy(q1);
+    CONTEND_EQUALITY(q0 == q1, 1);
+
+    // destroying the original keeps the coefficients alive for the copies
+    dotprod_rrrf_destroy(q0);
+    dotprod_rrrf_execute(q1, x, &y0);
+    CONTEND_DELTA(y0, 16.0f, tol);
+
+    // re-create one copy with new coefficients; the other is unaffected
+    q1 = dotprod_rrrf_recreate(q1, h1, 8);
+    dotprod_rrrf_execute(q1, x, &y0);
+    dotprod_rrrf_execute(q2, x, &y1);
+    CONTEND_DELTA(y0, -4.0f, tol);
+    CONTEND_DELTA(y1, 16.0f, tol);
+
+    // re-create the remaining (now unshared) object in reverse order
+    q2 = dotprod_rrrf_recreate_rev(q2, h0, 8);
+    dotprod_rrrf_execute(q2, x, &y1);
+    CONTEND_DELTA(y1, 20.0f, tol);
+
+    dotprod_rrrf_destroy(q1);
+    dotprod_rrrf_destroy(q2);
+}
+
+// objects created independently from identical coefficients share them
+void autotest_dotprod_rrrf_create_shared()
+{
+    float tol = 1e-6;
+    float h0[8] = { 1, 2, 3, 4, 5, 6, 7, 8};
+    float h1[8] = { 1, 2, 3, 4, 5, 6, 7, 8};
+    float h2[8] = { 1, 2, 3, 4, 5, 6, 7, 9};
+    float x [8] = { 1, 0, 1, 0, 1, 0, 1, 0};
+    float y0, y1;
+
+    // identical taps (in a different array) yield the same object; changing
+    // a single tap or the ordering does not
+    dotprod_rrrf q0 = dotprod_rrrf_create(h0, 8);
+    dotprod_rrrf q1 = dotprod_rrrf_create(h1, 8);
+    dotprod_rrrf q2 = dotprod_rrrf_create(h2, 8);
+    dotprod_rrrf q3 = dotprod_rrrf_create_rev(h0, 8);
+    CONTEND_EQUALITY(q0 == q1, 1);
+    CONTEND_EQUALITY(q0 == q2, 0);
+    CONTEND_EQUALITY(q0 == q3, 0);
+
+    // destroying one creator keeps the coefficients alive for the other
+    dotprod_rrrf_destroy(q0);
+    dotprod_rrrf_execute(q1, x, &y0);
+    dotprod_rrrf_execute(q3, x, &y1);
+    CONTEND_DELTA(y0, 16.0f, tol);
+    CONTEND_DELTA(y1, 20.0f, tol);
+
+    // once released, a new object with the same taps is created afresh
+    dotprod_rrrf_destroy(q1);
+    q0 = dotprod_rrrf_create(h0, 8);
+    dotprod_rrrf_execute(q0, x, &y0);
+    CONTEND_DELTA(y0, 16.0f, tol);
+
+    // an unshared object re-created with new taps is registered under them
+    float h3[8] = { 8, 7, 6, 5, 4, 3, 2, 1};
+    q0 = dotprod_rrrf_recreate(q0, h3, 8);
+    q1 = dotprod_rrrf_create(h3, 8);
+    CONTEND_EQUALITY(q0 == q1, 1);
+    dotprod_rrrf_execute(q1, x, &y0);
+    CONTEND_DELTA(y0, 20.0f, tol);
+
+    dotprod_rrrf_destroy(q1);
+    dotprod_rrrf_destroy(q0);
+    dotprod_rrrf_destroy(q2);
+    dotprod_rrrf_destroy(q3);
+}
@@ -0,0 +1,331 @@
+/*
+ * Copyright (c) 2007 - 2025 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+//
+// multi-lag auto-correlator
+//
+// Maintains the windowed auto-correlation for all lags 0..L at once,
+//   r[d] = sum_{k=0}^{W-1} x[n-k] conj(x[n-k-d]),
+// as running sums which are updated for every input sample with two
+// contiguous multiply-accumulate sweeps over the history. When a large
+// block is written (or the running sums have accumulated enough updates
+// to drift) the sums are instead recomputed exactly with FFT-based
+// cross-correlation the next time the output is requested.
+//
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+
+// defined:
+//  AUTOCORR_LAGS() name-mangling macro
+//  TI              type (input)
+//  TO              type (output)
+//  WINDOW()        window macro
+
+#if TI_COMPLEX
+#  define AUTOCORR_LAGS_CONJ(x) conjf(x)
+#else
+#  define AUTOCORR_LAGS_CONJ(x) (x)
+#endif
+
+struct AUTOCORR_LAGS(_s) {
+    unsigned int window_size;   // correlation window size, W
+    unsigned int max_lag;       // maximum lag, L
+    unsigned int buf_len;       // history length, W + L + 1
+
+    WINDOW()     w;             // conjugated input history [size: W+L+1]
+    TO *         r;             // running sums in reverse lag order [size: L+1]
+    int          stale;         // running sums need to be recomputed
+    unsigned int num_updates;   // incremental updates since last recompute
+
+    // FFT-based recomputation
+    unsigned int    nfft;       // transform size
+    float complex * buf_u;      // windowed input (time) [size: nfft]
+    float complex * buf_b;      // full history (time)   [size: nfft]
+    float complex * buf_U;      // windowed input (freq) [size: nfft]
+    float complex * buf_B;      // full history (freq)   [size: nfft]
+    FFT_PLAN        fft_u;      // forward transform of windowed input
+    FFT_PLAN        fft_b;      // forward transform of full history
+    FFT_PLAN        ifft;       // inverse transform of cross-spectrum
+};
+
+// recompute running sums exactly from history
+int AUTOCORR_LAGS(_recompute)(AUTOCORR_LAGS() _q);
+
+// create FFT buffers and plans
+int AUTOCORR_LAGS(_create_fft)(AUTOCORR_LAGS() _q);
+
+// create multi-lag auto-correlator object
+//  _window_size    : size of the correlator window
+//  _max_lag        : maximum lag [samples]
+AUTOCORR_LAGS() AUTOCORR_LAGS(_create)(unsigned int _window_size,
+                                       unsigned int _max_lag)
+{
+    // validate input
+    if (_window_size == 0)
+        return liquid_error_config("autocorr_lags_%s_create(), window size must be greater than zero", EXTENSION_FULL);
+
+    // create main object
+    AUTOCORR_LAGS() q = (AUTOCORR_LAGS()) malloc(sizeof(struct AUTOCORR_LAGS(_s)));
+    q->window_size = _window_size;
+    q->max_lag     = _max_lag;
+    q->buf_len     = q->window_size + q->max_lag + 1;
+
+    // create history and running sums
+    q->w = WINDOW(_create)(q->buf_len);
+    q->r = (TO *) malloc((q->max_lag+1)*sizeof(TO));
+
+    // the cross-correlation only requires non-negative lags of sequences
+    // no longer than the history, so no zero padding beyond it is needed
+    q->nfft = 1 << liquid_nextpow2(q->buf_len);
+    AUTOCORR_LAGS(_create_fft)(q);
+
+    // reset and return object
+    AUTOCORR_LAGS(_reset)(q);
+    return q;
+}
+
+// copy object including all internal objects and state
+AUTOCORR_LAGS() AUTOCORR_LAGS(_copy)(AUTOCORR_LAGS() q_orig)
+{
+    // validate input
+    if (q_orig == NULL)
+        return liquid_error_config("autocorr_lags_%s_copy(), object cannot be NULL", EXTENSION_FULL);
+
+    // create object and copy base parameters
+    AUTOCORR_LAGS() q_copy = (AUTOCORR_LAGS()) malloc(sizeof(struct AUTOCORR_LAGS(_s)));
+    memmove(q_copy, q_orig, sizeof(struct AUTOCORR_LAGS(_s)));
+
+    // copy history and running sums
+    q_copy->w = WINDOW(_copy)(q_orig->w);
+    q_copy->r = (TO *) liquid_malloc_copy(q_orig->r, q_orig->max_lag+1, sizeof(TO));
+
+    // FFT buffers hold no state between calls
+    AUTOCORR_LAGS(_create_fft)(q_copy);
+    return q_copy;
+}
+
+// destroy object, freeing internal memory
+int AUTOCORR_LAGS(_destroy)(AUTOCORR_LAGS() _q)
+{
+    WINDOW(_destroy)(_q->w);
+    free(_q->r);
+
+    // destroy FFT objects and buffers
+    FFT_DESTROY_PLAN(_q->fft_u);
+    FFT_DESTROY_PLAN(_q->fft_b);
+    FFT_DESTROY_PLAN(_q->ifft);
+    FFT_FREE(_q->buf_u);
+    FFT_FREE(_q->buf_b);
+    FFT_FREE(_q->buf_U);
+    FFT_FREE(_q->buf_B);
+
+    // free main object memory
+    free(_q);
+    return LIQUID_OK;
+}
+
+// reset object's internals
+int AUTOCORR_LAGS(_reset)(AUTOCORR_LAGS() _q)
+{
+    WINDOW(_reset)(_q->w);
+    memset(_q->r, 0, (_q->max_lag+1)*sizeof(TO));
+    _q->stale       = 0;
+    _q->num_updates = 0;
+    return LIQUID_OK;
+}
+
+// print object parameters to stdout
+int AUTOCORR_LAGS(_print)(AUTOCORR_LAGS() _q)
+{
+    printf("<liquid.autocorr_lags_%s, window=%u, max_lag=%u>\n",
+        EXTENSION_FULL, _q->window_size, _q->max_lag);
+    return LIQUID_OK;
+}
+
+// get correlator window size
+unsigned int AUTOCORR_LAGS(_get_window_size)(AUTOCORR_LAGS() _q)
+{
+    return _q->window_size;
+}
+
+// get maximum lag
+unsigned int AUTOCORR_LAGS(_get_max_lag)(AUTOCORR_LAGS() _q)
+{
+    return _q->max_lag;
+}
+
+// push sample into object, updating all lags
+int AUTOCORR_LAGS(_push)(AUTOCORR_LAGS() _q,
+                         TI              _x)
+{
+    WINDOW(_push)(_q->w, AUTOCORR_LAGS_CONJ(_x));
+    if (_q->stale)
+        return LIQUID_OK;
+
+    // With history b (conjugated, oldest first) of length W+L+1 and
+    // running sums stored in reverse lag order r[j] = rxx[L-j]:
+    //   r[j] += x[n] b[W+j] - x[n-W] b[j]
+    // so that both sweeps run over contiguous memory.
+    TI * b;
+    WINDOW(_read)(_q->w, &b);
+    TI x_new = _x;
+    TI x_old = AUTOCORR_LAGS_CONJ(b[_q->max_lag]);
+    TI * b_new = b + _q->window_size;
+    unsigned int j;
+    for (j=0; j<=_q->max_lag; j++)
+        _q->r[j] += x_new*b_new[j] - x_old*b[j];
+
+    // schedule exact recomputation to bound accumulated round-off error
+    _q->num_updates++;
+    if (_q->num_updates >= _q->buf_len)
+        _q->stale = 1;
+    return LIQUID_OK;
+}
+
+// write block of samples into object
+//  _q      :   auto-correlation object
+//  _x      :   input array [size: _n x 1]
+//  _n      :   number of input samples
+int AUTOCORR_LAGS(_write)(AUTOCORR_LAGS() _q,
+                          TI *            _x,
+                          unsigned int    _n)
+{
+    unsigned int i;
+
+    // if updating every lag for each sample costs more than recomputing
+    // all lags with FFTs, simply buffer the samples
+    float cost_fft = 3.0f * _q->nfft * log2f((float)_q->nfft);
+    if (!_q->stale && (float)_n*(_q->max_lag+1) > cost_fft)
+        _q->stale = 1;
+
+    if (_q->stale) {
+        for (i=0; i<_n; i++)
+            WINDOW(_push)(_q->w, AUTOCORR_LAGS_CONJ(_x[i]));
+        return LIQUID_OK;
+    }
+
+    for (i=0; i<_n; i++)
+        AUTOCORR_LAGS(_push)(_q, _x[i]);
+    return LIQUID_OK;
+}
+
+// compute auto-correlation for all lags
+//  _q      :   auto-correlation object
+//  _rxx    :   auto-correlation output, lags 0..L [size: L+1 x 1]
+int AUTOCORR_LAGS(_execute)(AUTOCORR_LAGS() _q,
+                            TO *            _rxx)
+{
+    if (_q->stale)
+        AUTOCORR_LAGS(_recompute)(_q);
+
+    unsigned int d;
+    for (d=0; d<=_q->max_lag; d++)
+        _rxx[d] = _q->r[_q->max_lag - d];
+    return LIQUID_OK;
+}
+
+// write block of samples and compute auto-correlation for all lags at
+// the end of the block
+//  _q      :   auto-correlation object
+//  _x      :   input array [size: _n x 1]
+//  _n      :   number of input samples
+//  _rxx    :   auto-correlation output, lags 0..L [size: L+1 x 1]
+int AUTOCORR_LAGS(_execute_block)(AUTOCORR_LAGS() _q,
+                                  TI *            _x,
+                                  unsigned int    _n,
+                                  TO *            _rxx)
+{
+    AUTOCORR_LAGS(_write)(_q, _x, _n);
+    return AUTOCORR_LAGS(_execute)(_q, _rxx);
+}
+
+// return sum of squares of samples in window (zero-lag auto-correlation)
+float AUTOCORR_LAGS(_get_energy)(AUTOCORR_LAGS() _q)
+{
+    if (_q->stale)
+        AUTOCORR_LAGS(_recompute)(_q);
+#if TO_COMPLEX
+    return crealf(_q->r[_q->max_lag]);
+#else
+    return _q->r[_q->max_lag];
+#endif
+}
+
+//
+// internal methods
+//
+
+// recompute running sums exactly from history using FFT-based
+// cross-correlation between the last W samples and the full history:
+//   rxx[d] = sum_p u[p] conj(x[p-d]),  u[p] = x[p] for p >= L+1, else 0
+int AUTOCORR_LAGS(_recompute)(AUTOCORR_LAGS() _q)
+{
+    TI * b;
+    WINDOW(_read)(_q->w, &b);
+    unsigned int i;
+    for (i=0; i<_q->nfft; i++) {
+        if (i < _q->buf_len) {
+            _q->buf_b[i] = AUTOCORR_LAGS_CONJ(b[i]);
+            _q->buf_u[i] = i > _q->max_lag ? _q->buf_b[i] : 0.0f;
+        } else {
+            _q->buf_b[i] = 0.0f;
+            _q->buf_u[i] = 0.0f;
+        }
+    }
+    FFT_EXECUTE(_q->fft_u);
+    FFT_EXECUTE(_q->fft_b);
+
+    // cross-spectrum, inverse transform in place of windowed input
+    for (i=0; i<_q->nfft; i++)
+        _q->buf_U[i] *= conjf(_q->buf_B[i]);
+    FFT_EXECUTE(_q->ifft);
+
+    // store in reverse lag order, scaled by inverse transform size
+    float g = 1.0f / (float)(_q->nfft);
+    for (i=0; i<=_q->max_lag; i++) {
+#if TO_COMPLEX
+        _q->r[_q->max_lag - i] = _q->buf_u[i] * g;
+#else
+        _q->r[_q->max_lag - i] = crealf(_q->buf_u[i]) * g;
+#endif
+    }
+    _q->stale       = 0;
+    _q->num_updates = 0;
+    return LIQUID_OK;
+}
+
+// create FFT buffers and plans
+int AUTOCORR_LAGS(_create_fft)(AUTOCORR_LAGS() _q)
+{
+    _q->buf_u = (float complex*) FFT_MALLOC(_q->nfft*sizeof(float complex));
+    _q->buf_b = (float complex*) FFT_MALLOC(_q->nfft*sizeof(float complex));
+    _q->buf_U = (float complex*) FFT_MALLOC(_q->nfft*sizeof(float complex));
+    _q->buf_B = (float complex*) FFT_MALLOC(_q->nfft*sizeof(float complex));
+    _q->fft_u = FFT_CREATE_PLAN(_q->nfft, _q->buf_u, _q->buf_U, FFT_DIR_FORWARD,  FFT_METHOD);
+    _q->fft_b = FFT_CREATE_PLAN(_q->nfft, _q->buf_b, _q->buf_B, FFT_DIR_FORWARD,  FFT_METHOD);
+    _q->ifft  = FFT_CREATE_PLAN(_q->nfft, _q->buf_U, _q->buf_u, FFT_DIR_BACKWARD, FFT_METHOD);
+    return LIQUID_OK;
+}
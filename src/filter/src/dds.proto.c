@@ -29,6 +29,10 @@
 
 #include "liquid.internal.h"
 
+// minimum length of internal buffers; block methods process as many
+// low-rate samples at a time as fit in the buffers
+#define LIQUID_DDS_BLOCK_LEN (1024)
+
 struct DDS(_s) {
     // user-defined parameters
     unsigned int    num_stages;         // number of halfband stages
@@ -117,7 +121,7 @@ DDS() DDS(_create)(unsigned int _num_stages,
     }
 
     // allocate memory for buffering
-    q->buffer_len = q->rate;
+    q->buffer_len = q->rate > LIQUID_DDS_BLOCK_LEN ? q->rate : LIQUID_DDS_BLOCK_LEN;
     q->buffer0 = (T*) malloc((q->buffer_len)*sizeof(T));
     q->buffer1 = (T*) malloc((q->buffer_len)*sizeof(T));
 
@@ -368,3 +372,102 @@ int DDS(_interp_execute)(DDS() _q,
     return LIQUID_OK;
 }
 
+// execute decimator on a block of samples; each half-band stage runs
+// over a whole chunk of samples before the next, followed by the mixer
+//  _q      :   dds object
+//  _x      :   input sample array [size: _n*2^num_stages x 1]
+//  _n      :   number of output samples
+//  _y      :   output sample array [size: _n x 1]
+int DDS(_decim_execute_block)(DDS()        _q,
+                              T *          _x,
+                              unsigned int _n,
+                              T *          _y)
+{
+    unsigned int s;         // stage counter
+    unsigned int i;         // output counter
+    unsigned int g;         // halfband resampler stage index (reversed)
+    TC g0 = _q->zeta * _q->scale;
+    while (_n > 0) {
+        // number of low-rate samples in this chunk
+        unsigned int c = _q->buffer_len / _q->rate;
+        if (c > _n) c = _n;
+
+        unsigned int k = c*_q->rate;    // number of inputs for this stage
+        T * b0 = _x;                    // input buffer pointer
+        T * b1 = _x;                    // output buffer pointer
+
+        // iterate through each stage
+        for (s=0; s<_q->num_stages; s++) {
+            // length halves with each iteration
+            k >>= 1;
+
+            // set output buffer pointer
+            b1 = s%2 == 0 ? _q->buffer0 : _q->buffer1;
+
+            // execute halfband decimator on entire chunk
+            g = _q->num_stages - s - 1;
+            RESAMP2(_decim_execute_block)(_q->halfband_resamp[g], b0, k, b1);
+            b0 = b1;
+        }
+
+        // mix down and apply scaling
+        NCO(_mix_block_down)(_q->ncox, b1, _y, c);
+        for (i=0; i<c; i++)
+            _y[i] *= g0;
+
+        // update pointers, counters
+        _x += c*_q->rate;
+        _y += c;
+        _n -= c;
+    }
+    return LIQUID_OK;
+}
+
+// execute interpolator on a block of samples; the mixer runs over a
+// whole chunk of samples followed by each half-band stage in turn
+//  _q      :   dds object
+//  _x      :   input sample array [size: _n x 1]
+//  _n      :   number of input samples
+//  _y      :   output sample array [size: _n*2^num_stages x 1]
+int DDS(_interp_execute_block)(DDS()        _q,
+                               T *          _x,
+                               unsigned int _n,
+                               T *          _y)
+{
+    unsigned int s;         // stage counter
+    unsigned int i;         // input counter
+    while (_n > 0) {
+        // number of low-rate samples in this chunk
+        unsigned int c = _q->buffer_len / _q->rate;
+        if (c > _n) c = _n;
+
+        // apply scaling and mix up
+        T * b0 = _q->num_stages == 0 ? _y : _q->buffer0;
+        for (i=0; i<c; i++)
+            b0[i] = _x[i] * _q->scale;
+        NCO(_mix_block_up)(_q->ncox, b0, b0, c);
+
+        // iterate through each stage, writing last stage to output
+        unsigned int k = c;     // number of inputs for this stage
+        T * b1 = NULL;          // output buffer pointer
+        for (s=0; s<_q->num_stages; s++) {
+            if (s == _q->num_stages-1)
+                b1 = _y;
+            else
+                b1 = s%2 == 0 ? _q->buffer1 : _q->buffer0;
+
+            // execute halfband interpolator on entire chunk
+            RESAMP2(_interp_execute_block)(_q->halfband_resamp[s], b0, k, b1);
+            b0 = b1;
+
+            // length doubles with each iteration
+            k <<= 1;
+        }
+
+        // update pointers, counters
+        _x += c;
+        _y += c*_q->rate;
+        _n -= c;
+    }
+    return LIQUID_OK;
+}
@@ -34,12 +34,19 @@ struct FDELAY(_s) {
     unsigned int    m;          // filter semi-length
     unsigned int    npfb;       // number of filters in polyphase filter-bank
     float           delay;      // current delay
-    WINDOW()        w;          // window for bulk delay
-    FIRPFB()        pfb;        // polyphase filter-bank for fractional delay
+    unsigned int    h_sub_len;  // length of each fractional-delay filter
+    WINDOW()        w;          // window for bulk delay and filter history
+    DOTPROD() *     dp;         // fractional-delay filters [size: npfb x 1]
     unsigned int    w_index;    // index: window (bulk delay)
     unsigned int    f_index;    // index: polyphase filter-bank (fractional delay)
 };
 
+// compute window and filter indices from delay
+int FDELAY(_compute_index)(FDELAY()       _q,
+                           float          _delay,
+                           unsigned int * _w_index,
+                           unsigned int * _f_index);
+
 // Create a delay object with a maximum offset and filter specification
 //  _nmax   : maximum integer sample offset
 //  _m      : polyphase filter-bank semi-length, _m > 0
@@ -62,12 +69,28 @@ FDELAY() FDELAY(_create)(unsigned int _nmax,
     q->m    = _m;
     q->npfb = _npfb;
 
-    // create window (internal buffer); provision 1 extra sample to account
-    // for additional delay
-    q->w = WINDOW(_create)(q->nmax + 1);
+    // design polyphase filter-bank prototype (same as firpfb default)
+    unsigned int H_len = 2*q->npfb*q->m + 1;
+    float Hf[H_len];
+    liquid_firdes_kaiser(H_len, 0.5f/(float)q->npfb, 60.0f, 0.0f, Hf);
+
+    // create fractional-delay filters; each is realized as a dotprod object
+    // loaded in reverse order
+    q->h_sub_len = H_len / q->npfb;
+    q->dp = (DOTPROD()*) malloc((q->npfb)*sizeof(DOTPROD()));
+    TC h_sub[q->h_sub_len];
+    unsigned int i, n;
+    for (i=0; i<q->npfb; i++) {
+        for (n=0; n<q->h_sub_len; n++)
+            h_sub[q->h_sub_len-n-1] = Hf[i + n*(q->npfb)];
+        q->dp[i] = DOTPROD(_create)(h_sub, q->h_sub_len);
+    }
 
-    // create polyphase filter-bank
-    q->pfb = FIRPFB(_create_default)(q->npfb, q->m);
+    // create window (internal buffer); the bulk delay and the filter
+    // history share a single buffer so that the fractional-delay filter
+    // operates directly on the delayed samples. Provision 1 extra sample
+    // to account for additional delay.
+    q->w = WINDOW(_create)(q->nmax + q->h_sub_len);
 
     // reset filter state (clear buffer)
     FDELAY(_reset)(q);
@@ -94,8 +117,11 @@ FDELAY() FDELAY(_copy)(FDELAY() q_orig)
     memmove(q_copy, q_orig, sizeof(struct FDELAY(_s)));
 
     // copy internal objects
-    q_copy->w   = WINDOW(_copy)(q_orig->w);
-    q_copy->pfb = FIRPFB(_copy)(q_orig->pfb);
+    q_copy->w  = WINDOW(_copy)(q_orig->w);
+    q_copy->dp = (DOTPROD()*) malloc((q_orig->npfb)*sizeof(DOTPROD()));
+    unsigned int i;
+    for (i=0; i<q_orig->npfb; i++)
+        q_copy->dp[i] = DOTPROD(_copy)(q_orig->dp[i]);
     return q_copy;
 }
 
@@ -103,7 +129,10 @@ FDELAY() FDELAY(_copy)(FDELAY() q_orig)
 int FDELAY(_destroy)(FDELAY() _q)
 {
     WINDOW(_destroy)(_q->w);
-    FIRPFB(_destroy)(_q->pfb);
+    unsigned int i;
+    for (i=0; i<_q->npfb; i++)
+        DOTPROD(_destroy)(_q->dp[i]);
+    free(_q->dp);
     free(_q);
     return LIQUID_OK;
 }
@@ -115,7 +144,6 @@ int FDELAY(_reset)(FDELAY() _q)
     _q->w_index = _q->nmax-1;
     _q->f_index = 0;
     WINDOW(_reset)(_q->w);
-    FIRPFB(_reset)(_q->pfb);
     return LIQUID_OK;
 }
 
@@ -136,35 +164,9 @@ float FDELAY(_get_delay)(FDELAY() _q)
 int FDELAY(_set_delay)(FDELAY() _q,
                        float    _delay)
 {
-    if (_delay < 0) {
-        return liquid_error(LIQUID_EIVAL,"fdelay_%s_set_delay(), delay (%g) cannot be negative",
-                EXTENSION_FULL, _delay);
-    } else if (_delay > _q->nmax) {
-        return liquid_error(LIQUID_EIVAL,"fdelay_%s_set_delay(), delay (%g) cannot exceed maximum (%u)",
-                EXTENSION_FULL, _delay, _q->nmax);
-    }
-
-    // compute offset from delay and integer/fractional components
-    float offset   = (float)(_q->nmax) - _delay;
-    int   intpart  = (int) floorf(offset);
-    float fracpart = offset - (float)intpart;
-
-    // set indices appropriately
-    _q->w_index = intpart;
-    _q->f_index = (unsigned int)roundf(_q->npfb * fracpart);
-    while (_q->f_index >= _q->npfb) {
-        _q->w_index++;
-        _q->f_index -= _q->npfb;
-    }
-    // ensure valid range; clip if needed. Note that w_index can be equal
-    // to nmax because the window was provisioned for nmax+1
-    if (_q->w_index > _q->nmax)
-        return liquid_error(LIQUID_EINT,"fdelay_%s_set_delay(), window index exceeds maximum", EXTENSION_FULL);
-#if 0
-    // debug
-    printf("delay:%f -> offset:%f -> %d + %f -> %d + (%u/%u)\n",
-           _delay, offset, intpart, fracpart, _q->w_index, _q->f_index, _q->npfb);
-#endif
+    int rc = FDELAY(_compute_index)(_q, _delay, &_q->w_index, &_q->f_index);
+    if (rc != LIQUID_OK)
+        return rc;
     _q->delay = _delay;
     return LIQUID_OK;
 }
@@ -195,15 +197,7 @@ unsigned int FDELAY(_get_npfb)(FDELAY() _q)
 int FDELAY(_push)(FDELAY() _q,
                   TI       _x)
 {
-    // apply bulk delay
-    WINDOW(_push)(_q->w, _x);
-    TO v;
-    WINDOW(_index)(_q->w, _q->w_index, &v);
-
-    // apply fractional delay
-    FIRPFB(_push)(_q->pfb, v);
-
-    return LIQUID_OK;
+    return WINDOW(_push)(_q->w, _x);
 }
 
 // Write block of samplex into filter object's internal buffer
@@ -214,13 +208,7 @@ int FDELAY(_write)(FDELAY()     _q,
                    TI *         _x,
                    unsigned int _n)
 {
-    unsigned int i;
-    for (i=0; i<_n; i++) {
-        if ( FDELAY(_push)(_q, _x[i]) != LIQUID_OK) {
-            return liquid_error(LIQUID_EINT,"fdelay_%s_write(), could not write sample", EXTENSION_FULL);
-        }
-    }
-    return LIQUID_OK;
+    return WINDOW(_write)(_q->w, _x, _n);
 }
 
 // Execute vector dot product on the filter's internal buffer and
@@ -230,8 +218,11 @@ int FDELAY(_write)(FDELAY()     _q,
 int FDELAY(_execute)(FDELAY() _q,
                      TO *     _y)
 {
-    FIRPFB(_execute)(_q->pfb, _q->f_index, _y);
-    return LIQUID_OK;
+    // the window index selects the bulk delay: the fractional-delay
+    // filter runs on the h_sub_len samples starting at this offset
+    TI * r;
+    WINDOW(_read)(_q->w, &r);
+    return DOTPROD(_execute)(_q->dp[_q->f_index], r + _q->w_index, _y);
 }
 
 // Execute the filter on a block of input samples; in-place operation
@@ -245,11 +236,87 @@ int FDELAY(_execute_block)(FDELAY()     _q,
                            unsigned int _n,
                            TO *         _y)
 {
+    DOTPROD() dp = _q->dp[_q->f_index];
+    TI * r;
     unsigned int i;
     for (i=0; i<_n; i++) {
-        FDELAY(_push)(_q, _x[i]);
-        FDELAY(_execute)(_q, _y+i);
+        WINDOW(_push)(_q->w, _x[i]);
+        WINDOW(_read)(_q->w, &r);
+        DOTPROD(_execute)(dp, r + _q->w_index, _y+i);
     }
     return LIQUID_OK;
 }
 
+// Execute the filter on a block of input samples, applying a different
+// delay to each; in-place operation is permitted for _x and _y. The
+// object's delay is left at the last value in _delay.
+//  _q      : filter object
+//  _x      : pointer to input array, [size: _n x 1]
+//  _delay  : pointer to delay array, each in [0,nmax], [size: _n x 1]
+//  _n      : number of input, output samples
+//  _y      : pointer to output array, [size: _n x 1]
+int FDELAY(_execute_block_delay)(FDELAY()     _q,
+                                 TI *         _x,
+                                 float *      _delay,
+                                 unsigned int _n,
+                                 TO *         _y)
+{
+    unsigned int w_index, f_index;
+    TI * r;
+    unsigned int i;
+    for (i=0; i<_n; i++) {
+        int rc = FDELAY(_compute_index)(_q, _delay[i], &w_index, &f_index);
+        if (rc != LIQUID_OK)
+            return rc;
+        WINDOW(_push)(_q->w, _x[i]);
+        WINDOW(_read)(_q->w, &r);
+        DOTPROD(_execute)(_q->dp[f_index], r + w_index, _y+i);
+    }
+    if (_n > 0) {
+        _q->w_index = w_index;
+        _q->f_index = f_index;
+        _q->delay   = _delay[_n-1];
+    }
+    return LIQUID_OK;
+}
+
+// compute window and filter indices from delay
+int FDELAY(_compute_index)(FDELAY()       _q,
+                           float          _delay,
+                           unsigned int * _w_index,
+                           unsigned int * _f_index)
+{
+    if (_delay < 0) {
+        return liquid_error(LIQUID_EIVAL,"fdelay_%s_compute_index(), delay (%g) cannot be negative",
+                EXTENSION_FULL, _delay);
+    } else if (_delay > _q->nmax) {
+        return liquid_error(LIQUID_EIVAL,"fdelay_%s_compute_index(), delay (%g) cannot exceed maximum (%u)",
+                EXTENSION_FULL, _delay, _q->nmax);
+    }
+
+    // compute offset from delay and integer/fractional components
+    float offset   = (float)(_q->nmax) - _delay;
+    int   intpart  = (int) floorf(offset);
+    float fracpart = offset - (float)intpart;
+
+    // set indices appropriately
+    unsigned int w_index = intpart;
+    unsigned int f_index = (unsigned int)roundf(_q->npfb * fracpart);
+    while (f_index >= _q->npfb) {
+        w_index++;
+        f_index -= _q->npfb;
+    }
+    // ensure valid range; clip if needed. Note that w_index can be equal
+    // to nmax because the window was provisioned for nmax+1
+    if (w_index > _q->nmax)
+        return liquid_error(LIQUID_EINT,"fdelay_%s_compute_index(), window index exceeds maximum", EXTENSION_FULL);
+#if 0
+    // debug
+    printf("delay:%f -> offset:%f -> %d + %f -> %d + (%u/%u)\n",
+           _delay, offset, intpart, fracpart, w_index, f_index, _q->npfb);
+#endif
+    *_w_index = w_index;
+    *_f_index = f_index;
+    return LIQUID_OK;
+}
+
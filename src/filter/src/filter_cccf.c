@@ -32,15 +32,18 @@
 
 // 
 #define AUTOCORR(name)      LIQUID_CONCAT(autocorr_cccf,name)
+#define AUTOCORR_LAGS(name) LIQUID_CONCAT(autocorr_lags_cccf,name)
 #define DDS(name)           LIQUID_CONCAT(dds_cccf,name)
 #define FFTFILT(name)       LIQUID_CONCAT(fftfilt_cccf,name)
 #define FIRDECIM(name)      LIQUID_CONCAT(firdecim_cccf,name)
 #define FIRFILT(name)       LIQUID_CONCAT(firfilt_cccf,name)
+#define FIRFILT_MULTI(name) LIQUID_CONCAT(firfilt_multi_cccf,name)
 #define FIRINTERP(name)     LIQUID_CONCAT(firinterp_cccf,name)
 #define FIRPFB(name)        LIQUID_CONCAT(firpfb_cccf,name)
 #define IIRDECIM(name)      LIQUID_CONCAT(iirdecim_cccf,name)
 #define IIRFILT(name)       LIQUID_CONCAT(iirfilt_cccf,name)
 #define IIRFILTSOS(name)    LIQUID_CONCAT(iirfiltsos_cccf,name)
+#define IIRFILT_MULTI(name) LIQUID_CONCAT(iirfilt_multi_cccf,name)
 #define IIRINTERP(name)     LIQUID_CONCAT(iirinterp_cccf,name)
 #define NCO(name)           LIQUID_CONCAT(nco_crcf,name)
 #define MSRESAMP(name)      LIQUID_CONCAT(msresamp_cccf,name)
@@ -69,15 +72,18 @@
 
 // prototype files
 #include "autocorr.proto.c"
+#include "autocorr_lags.proto.c"
 #include "dds.proto.c"
 #include "fftfilt.proto.c"
 #include "firdecim.proto.c"
 #include "firfilt.proto.c"
+#include "firfilt_multi.proto.c"
 #include "firinterp.proto.c"
 #include "firpfb.proto.c"
 #include "iirdecim.proto.c"
 #include "iirfilt.proto.c"
 #include "iirfiltsos.proto.c"
+#include "iirfilt_multi.proto.c"
 #include "iirinterp.proto.c"
 //#include "qmfb.proto.c"
 // ordfilt
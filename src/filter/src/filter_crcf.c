@@ -32,16 +32,19 @@
 
 // 
 #define AUTOCORR(name)      LIQUID_CONCAT(autocorr_crcf,name)
+#define AUTOCORR_LAGS(name) LIQUID_CONCAT(autocorr_lags_crcf,name)
 #define FDELAY(name)        LIQUID_CONCAT(fdelay_crcf,name)
 #define FFTFILT(name)       LIQUID_CONCAT(fftfilt_crcf,name)
 #define FIRDECIM(name)      LIQUID_CONCAT(firdecim_crcf,name)
 #define FIRFARROW(name)     LIQUID_CONCAT(firfarrow_crcf,name)
 #define FIRFILT(name)       LIQUID_CONCAT(firfilt_crcf,name)
+#define FIRFILT_MULTI(name) LIQUID_CONCAT(firfilt_multi_crcf,name)
 #define FIRINTERP(name)     LIQUID_CONCAT(firinterp_crcf,name)
 #define FIRPFB(name)        LIQUID_CONCAT(firpfb_crcf,name)
 #define IIRDECIM(name)      LIQUID_CONCAT(iirdecim_crcf,name)
 #define IIRFILT(name)       LIQUID_CONCAT(iirfilt_crcf,name)
 #define IIRFILTSOS(name)    LIQUID_CONCAT(iirfiltsos_crcf,name)
+#define IIRFILT_MULTI(name) LIQUID_CONCAT(iirfilt_multi_crcf,name)
 #define IIRINTERP(name)     LIQUID_CONCAT(iirinterp_crcf,name)
 #define MSRESAMP(name)      LIQUID_CONCAT(msresamp_crcf,name)
 #define MSRESAMP2(name)     LIQUID_CONCAT(msresamp2_crcf,name)
@@ -69,16 +72,19 @@
 
 // prototype files
 //#include "autocorr.proto.c"
+//#include "autocorr_lags.proto.c"
 #include "fdelay.proto.c"
 #include "fftfilt.proto.c"
 #include "firdecim.proto.c"
 #include "firfarrow.proto.c"
 #include "firfilt.proto.c"
+#include "firfilt_multi.proto.c"
 #include "firinterp.proto.c"
 #include "firpfb.proto.c"
 #include "iirdecim.proto.c"
 #include "iirfilt.proto.c"
 #include "iirfiltsos.proto.c"
+#include "iirfilt_multi.proto.c"
 #include "iirinterp.proto.c"
 #include "msresamp.proto.c"
 #include "msresamp2.proto.c"
@@ -32,17 +32,20 @@
 
 // 
 #define AUTOCORR(name)      LIQUID_CONCAT(autocorr_rrrf,name)
+#define AUTOCORR_LAGS(name) LIQUID_CONCAT(autocorr_lags_rrrf,name)
 #define FDELAY(name)        LIQUID_CONCAT(fdelay_rrrf,name)
 #define FFTFILT(name)       LIQUID_CONCAT(fftfilt_rrrf,name)
 #define FIRDECIM(name)      LIQUID_CONCAT(firdecim_rrrf,name)
 #define FIRFARROW(name)     LIQUID_CONCAT(firfarrow_rrrf,name)
 #define FIRFILT(name)       LIQUID_CONCAT(firfilt_rrrf,name)
+#define FIRFILT_MULTI(name) LIQUID_CONCAT(firfilt_multi_rrrf,name)
 #define FIRINTERP(name)     LIQUID_CONCAT(firinterp_rrrf,name)
 #define FIRHILB(name)       LIQUID_CONCAT(firhilbf,name)
 #define FIRPFB(name)        LIQUID_CONCAT(firpfb_rrrf,name)
 #define IIRDECIM(name)      LIQUID_CONCAT(iirdecim_rrrf,name)
 #define IIRFILT(name)       LIQUID_CONCAT(iirfilt_rrrf,name)
 #define IIRFILTSOS(name)    LIQUID_CONCAT(iirfiltsos_rrrf,name)
+#define IIRFILT_MULTI(name) LIQUID_CONCAT(iirfilt_multi_rrrf,name)
 #define IIRHILB(name)       LIQUID_CONCAT(iirhilbf,name)
 #define IIRINTERP(name)     LIQUID_CONCAT(iirinterp_rrrf,name)
 #define MSRESAMP(name)      LIQUID_CONCAT(msresamp_rrrf,name)
@@ -71,17 +74,20 @@
 
 // prototype files
 #include "autocorr.proto.c"
+#include "autocorr_lags.proto.c"
 #include "fdelay.proto.c"
 #include "fftfilt.proto.c"
 #include "firdecim.proto.c"
 #include "firfarrow.proto.c"
 #include "firfilt.proto.c"
+#include "firfilt_multi.proto.c"
 #include "firinterp.proto.c"
 #include "firhilb.proto.c"
 #include "firpfb.proto.c"
 #include "iirdecim.proto.c"
 #include "iirfilt.proto.c"
 #include "iirfiltsos.proto.c"
+#include "iirfilt_multi.proto.c"
 #include "iirhilb.proto.c"
 #include "iirinterp.proto.c"
 #include "msresamp.proto.c"
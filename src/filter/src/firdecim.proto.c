@@ -55,19 +55,19 @@ FIRDECIM() FIRDECIM(_create)(unsigned int _M,
     q->h_len = _h_len;
     q->M     = _M;
 
-    // allocate memory for coefficients
-    q->h = (TC*) malloc((q->h_len)*sizeof(TC));
-
-    // load filter in reverse order
+    // load filter in reverse order, sharing read-only array with identical
+    // filters
+    TC h[_h_len];
     unsigned int i;
-    for (i=0; i<q->h_len; i++)
-        q->h[i] = _h[_h_len-i-1];
+    for (i=0; i<_h_len; i++)
+        h[i] = _h[_h_len-i-1];
+    q->h = (TC*) liquid_shared_malloc_copy(h, _h_len, sizeof(TC));
 
     // create window (internal buffer)
     q->w = WINDOW(_create)(q->h_len);
 
     // create dot product object
-    q->dp = DOTPROD(_create)(q->h, q->h_len);
+    q->dp = DOTPROD(_create_rev)(_h, q->h_len);
 
     // set default scaling
     q->scale = 1;
@@ -159,8 +159,10 @@ FIRDECIM() FIRDECIM(_copy)(FIRDECIM() q_orig)
     FIRDECIM() q_copy = (FIRDECIM()) malloc(sizeof(struct FIRDECIM(_s)));
     q_copy->h_len = q_orig->h_len;
     q_copy->M     = q_orig->M;
-    q_copy->h     = (TC *) malloc((q_orig->h_len)*sizeof(TC));
-    memmove(q_copy->h, q_orig->h, (q_orig->h_len)*sizeof(TC));
+    q_copy->h     = q_orig->h;
+
+    // filter coefficients are read-only; share them
+    liquid_shared_retain(q_copy->h);
 
     // copy window, dotprod,m and scale
     q_copy->w     = WINDOW(_copy)(q_orig->w);
@@ -174,7 +176,7 @@ int FIRDECIM(_destroy)(FIRDECIM() _q)
 {
     WINDOW(_destroy)(_q->w);
     DOTPROD(_destroy)(_q->dp);
-    free(_q->h);
+    liquid_shared_free(_q->h);
     free(_q);
     return LIQUID_OK;
 }
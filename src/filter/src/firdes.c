@@ -417,31 +417,44 @@ int liquid_firdes_prototype(liquid_firfilt_type _type,
                                         LIQUID_FIRDESPM_FLATWEIGHT,
                                         LIQUID_FIRDESPM_FLATWEIGHT};
 
+    // check design cache (designs based on Parks-McClellan are memoized
+    // within firdespm_run() and are not stored here)
+    int cache = _type != LIQUID_FIRFILT_PM && _type != LIQUID_FIRFILT_hM3;
+    float key[6] = {0, (float)_type, (float)_k, (float)_m, _beta, _dt};
+    if (cache && liquid_firdes_cache_lookup(key, sizeof(key), _h, h_len))
+        return LIQUID_OK;
+
+    int rc = LIQUID_OK;
     switch (_type) {
     // Nyquist filter prototypes
-    case LIQUID_FIRFILT_KAISER:     return liquid_firdes_kaiser   (h_len, fc, as, _dt, _h);
+    case LIQUID_FIRFILT_KAISER:     rc = liquid_firdes_kaiser   (h_len, fc, as, _dt, _h); break;
     case LIQUID_FIRFILT_PM:
         // NOTE: input timing offset is ignored here
-        return firdespm_run(h_len, 3, bands, des, weights, wtype, LIQUID_FIRDESPM_BANDPASS, _h);
-    case LIQUID_FIRFILT_RCOS:       return liquid_firdes_rcos     (_k, _m, _beta, _dt, _h);
-    case LIQUID_FIRFILT_FEXP:       return liquid_firdes_fexp     (_k, _m, _beta, _dt, _h);
-    case LIQUID_FIRFILT_FSECH:      return liquid_firdes_fsech    (_k, _m, _beta, _dt, _h);
-    case LIQUID_FIRFILT_FARCSECH:   return liquid_firdes_farcsech (_k, _m, _beta, _dt, _h);
+        rc = firdespm_run(h_len, 3, bands, des, weights, wtype, LIQUID_FIRDESPM_BANDPASS, _h);
+        break;
+    case LIQUID_FIRFILT_RCOS:       rc = liquid_firdes_rcos     (_k, _m, _beta, _dt, _h); break;
+    case LIQUID_FIRFILT_FEXP:       rc = liquid_firdes_fexp     (_k, _m, _beta, _dt, _h); break;
+    case LIQUID_FIRFILT_FSECH:      rc = liquid_firdes_fsech    (_k, _m, _beta, _dt, _h); break;
+    case LIQUID_FIRFILT_FARCSECH:   rc = liquid_firdes_farcsech (_k, _m, _beta, _dt, _h); break;
 
     // root-Nyquist filter prototypes
-    case LIQUID_FIRFILT_ARKAISER:   return liquid_firdes_arkaiser (_k, _m, _beta, _dt, _h);
-    case LIQUID_FIRFILT_RKAISER:    return liquid_firdes_rkaiser  (_k, _m, _beta, _dt, _h);
-    case LIQUID_FIRFILT_RRC:        return liquid_firdes_rrcos    (_k, _m, _beta, _dt, _h);
-    case LIQUID_FIRFILT_hM3:        return liquid_firdes_hM3      (_k, _m, _beta, _dt, _h);
-    case LIQUID_FIRFILT_GMSKTX:     return liquid_firdes_gmsktx   (_k, _m, _beta, _dt, _h);
-    case LIQUID_FIRFILT_GMSKRX:     return liquid_firdes_gmskrx   (_k, _m, _beta, _dt, _h);
-    case LIQUID_FIRFILT_RFEXP:      return liquid_firdes_rfexp    (_k, _m, _beta, _dt, _h);
-    case LIQUID_FIRFILT_RFSECH:     return liquid_firdes_rfsech   (_k, _m, _beta, _dt, _h);
-    case LIQUID_FIRFILT_RFARCSECH:  return liquid_firdes_rfarcsech(_k, _m, _beta, _dt, _h);
+    case LIQUID_FIRFILT_ARKAISER:   rc = liquid_firdes_arkaiser (_k, _m, _beta, _dt, _h); break;
+    case LIQUID_FIRFILT_RKAISER:    rc = liquid_firdes_rkaiser  (_k, _m, _beta, _dt, _h); break;
+    case LIQUID_FIRFILT_RRC:        rc = liquid_firdes_rrcos    (_k, _m, _beta, _dt, _h); break;
+    case LIQUID_FIRFILT_hM3:        rc = liquid_firdes_hM3      (_k, _m, _beta, _dt, _h); break;
+    case LIQUID_FIRFILT_GMSKTX:     rc = liquid_firdes_gmsktx   (_k, _m, _beta, _dt, _h); break;
+    case LIQUID_FIRFILT_GMSKRX:     rc = liquid_firdes_gmskrx   (_k, _m, _beta, _dt, _h); break;
+    case LIQUID_FIRFILT_RFEXP:      rc = liquid_firdes_rfexp    (_k, _m, _beta, _dt, _h); break;
+    case LIQUID_FIRFILT_RFSECH:     rc = liquid_firdes_rfsech   (_k, _m, _beta, _dt, _h); break;
+    case LIQUID_FIRFILT_RFARCSECH:  rc = liquid_firdes_rfarcsech(_k, _m, _beta, _dt, _h); break;
     default:
         return liquid_error(LIQUID_EICONFIG,"liquid_firdes_prototype(), filter type '%d'", _type);
     }
-    return LIQUID_OK;
+
+    // store design in cache
+    if (cache && rc == LIQUID_OK)
+        liquid_firdes_cache_insert(key, sizeof(key), _h, h_len);
+    return rc;
 }
 
 
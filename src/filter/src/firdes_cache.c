@@ -0,0 +1,294 @@
+/*
+ * Copyright (c) 2007 - 2025 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// Memoized filter design cache
+//
+// Designs such as the iterative root-Nyquist Kaiser filter and the
+// Parks-McClellan algorithm are expensive relative to creating the
+// objects which use them. When enabled, the cache stores the output
+// coefficients of liquid_firdes_prototype() and firdespm_run() keyed on
+// their full set of input parameters so that subsequent designs with the
+// same parameters are simply copied. The cache is global, protected by a
+// lock, and can be saved to and loaded from a file.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "liquid.internal.h"
+
+#define LIQUID_FIRDES_CACHE_NUM_BUCKETS (64)
+#define LIQUID_FIRDES_CACHE_MAGIC       "liquid-firdes-cache"
+#define LIQUID_FIRDES_CACHE_VERSION     (1)
+
+// cache entry (singly-linked within a hash bucket)
+struct liquid_firdes_cache_entry_s {
+    uint32_t        hash;       // hash of key
+    unsigned int    key_len;    // key length (bytes)
+    unsigned char * key;        // packed design parameters
+    unsigned int    h_len;      // number of coefficients
+    float *         h;          // coefficients
+    struct liquid_firdes_cache_entry_s * next;
+};
+
+// global cache state
+static struct {
+    char         lock;          // spin lock protecting all fields below
+    int          enabled;       // cache enabled flag
+    unsigned int num_entries;   // number of stored designs
+    struct liquid_firdes_cache_entry_s * buckets[LIQUID_FIRDES_CACHE_NUM_BUCKETS];
+} liquid_firdes_cache = {0, 0, 0, {NULL}};
+
+// 32-bit FNV-1a hash of key
+static uint32_t liquid_firdes_cache_hash(const void * _key,
+                                         unsigned int _key_len)
+{
+    const unsigned char * p = (const unsigned char *) _key;
+    uint32_t hash = 2166136261u;
+    unsigned int i;
+    for (i=0; i<_key_len; i++) {
+        hash ^= p[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+// find entry (lock must be held)
+static struct liquid_firdes_cache_entry_s * liquid_firdes_cache_find(
+    uint32_t     _hash,
+    const void * _key,
+    unsigned int _key_len)
+{
+    struct liquid_firdes_cache_entry_s * e =
+        liquid_firdes_cache.buckets[_hash % LIQUID_FIRDES_CACHE_NUM_BUCKETS];
+    for ( ; e != NULL; e = e->next) {
+        if (e->hash == _hash && e->key_len == _key_len &&
+            memcmp(e->key, _key, _key_len) == 0)
+        {
+            return e;
+        }
+    }
+    return NULL;
+}
+
+int liquid_firdes_cache_enable(void)
+{
+    liquid_spinlock_acquire(&liquid_firdes_cache.lock);
+    liquid_firdes_cache.enabled = 1;
+    liquid_spinlock_release(&liquid_firdes_cache.lock);
+    return LIQUID_OK;
+}
+
+int liquid_firdes_cache_disable(void)
+{
+    liquid_spinlock_acquire(&liquid_firdes_cache.lock);
+    liquid_firdes_cache.enabled = 0;
+    liquid_spinlock_release(&liquid_firdes_cache.lock);
+    return LIQUID_OK;
+}
+
+int liquid_firdes_cache_is_enabled(void)
+{
+    liquid_spinlock_acquire(&liquid_firdes_cache.lock);
+    int enabled = liquid_firdes_cache.enabled;
+    liquid_spinlock_release(&liquid_firdes_cache.lock);
+    return enabled;
+}
+
+unsigned int liquid_firdes_cache_get_num_entries(void)
+{
+    liquid_spinlock_acquire(&liquid_firdes_cache.lock);
+    unsigned int num_entries = liquid_firdes_cache.num_entries;
+    liquid_spinlock_release(&liquid_firdes_cache.lock);
+    return num_entries;
+}
+
+int liquid_firdes_cache_clear(void)
+{
+    liquid_spinlock_acquire(&liquid_firdes_cache.lock);
+    unsigned int i;
+    for (i=0; i<LIQUID_FIRDES_CACHE_NUM_BUCKETS; i++) {
+        struct liquid_firdes_cache_entry_s * e = liquid_firdes_cache.buckets[i];
+        while (e != NULL) {
+            struct liquid_firdes_cache_entry_s * next = e->next;
+            free(e->key);
+            free(e->h);
+            free(e);
+            e = next;
+        }
+        liquid_firdes_cache.buckets[i] = NULL;
+    }
+    liquid_firdes_cache.num_entries = 0;
+    liquid_spinlock_release(&liquid_firdes_cache.lock);
+    return LIQUID_OK;
+}
+
+int liquid_firdes_cache_lookup(const void * _key,
+                               unsigned int _key_len,
+                               float *      _h,
+                               unsigned int _h_len)
+{
+    uint32_t hash = liquid_firdes_cache_hash(_key, _key_len);
+    int found = 0;
+
+    liquid_spinlock_acquire(&liquid_firdes_cache.lock);
+    if (liquid_firdes_cache.enabled) {
+        struct liquid_firdes_cache_entry_s * e =
+            liquid_firdes_cache_find(hash, _key, _key_len);
+        if (e != NULL && e->h_len == _h_len) {
+            memmove(_h, e->h, _h_len*sizeof(float));
+            found = 1;
+        }
+    }
+    liquid_spinlock_release(&liquid_firdes_cache.lock);
+    return found;
+}
+
+// insert entry without checking if cache is enabled
+static int liquid_firdes_cache_insert_entry(const void *  _key,
+                                            unsigned int  _key_len,
+                                            const float * _h,
+                                            unsigned int  _h_len)
+{
+    uint32_t hash = liquid_firdes_cache_hash(_key, _key_len);
+
+    // allocate entry outside of lock
+    struct liquid_firdes_cache_entry_s * e =
+        (struct liquid_firdes_cache_entry_s *) malloc(sizeof(struct liquid_firdes_cache_entry_s));
+    e->hash    = hash;
+    e->key_len = _key_len;
+    e->key     = (unsigned char *) liquid_malloc_copy((void*)_key, _key_len, 1);
+    e->h_len   = _h_len;
+    e->h       = (float *) liquid_malloc_copy((void*)_h, _h_len, sizeof(float));
+
+    liquid_spinlock_acquire(&liquid_firdes_cache.lock);
+    if (liquid_firdes_cache_find(hash, _key, _key_len) == NULL) {
+        unsigned int b = hash % LIQUID_FIRDES_CACHE_NUM_BUCKETS;
+        e->next = liquid_firdes_cache.buckets[b];
+        liquid_firdes_cache.buckets[b] = e;
+        liquid_firdes_cache.num_entries++;
+        e = NULL;
+    }
+    liquid_spinlock_release(&liquid_firdes_cache.lock);
+
+    // another thread stored the same design first
+    if (e != NULL) {
+        free(e->key);
+        free(e->h);
+        free(e);
+    }
+    return LIQUID_OK;
+}
+
+int liquid_firdes_cache_insert(const void *  _key,
+                               unsigned int  _key_len,
+                               const float * _h,
+                               unsigned int  _h_len)
+{
+    if (!liquid_firdes_cache_is_enabled())
+        return LIQUID_OK;
+    return liquid_firdes_cache_insert_entry(_key, _key_len, _h, _h_len);
+}
+
+// save cache contents to binary file
+int liquid_firdes_cache_save(const char * _filename)
+{
+    FILE * fid = fopen(_filename, "wb");
+    if (fid == NULL)
+        return liquid_error(LIQUID_EIO,"liquid_firdes_cache_save(), could not open '%s' for writing", _filename);
+
+    liquid_spinlock_acquire(&liquid_firdes_cache.lock);
+    uint32_t version     = LIQUID_FIRDES_CACHE_VERSION;
+    uint32_t num_entries = liquid_firdes_cache.num_entries;
+    fwrite(LIQUID_FIRDES_CACHE_MAGIC, 1, sizeof(LIQUID_FIRDES_CACHE_MAGIC), fid);
+    fwrite(&version,     sizeof(uint32_t), 1, fid);
+    fwrite(&num_entries, sizeof(uint32_t), 1, fid);
+    unsigned int i;
+    for (i=0; i<LIQUID_FIRDES_CACHE_NUM_BUCKETS; i++) {
+        struct liquid_firdes_cache_entry_s * e;
+        for (e = liquid_firdes_cache.buckets[i]; e != NULL; e = e->next) {
+            uint32_t key_len = e->key_len;
+            uint32_t h_len   = e->h_len;
+            fwrite(&key_len, sizeof(uint32_t), 1,        fid);
+            fwrite(e->key,   1,                key_len,  fid);
+            fwrite(&h_len,   sizeof(uint32_t), 1,        fid);
+            fwrite(e->h,     sizeof(float),    h_len,    fid);
+        }
+    }
+    liquid_spinlock_release(&liquid_firdes_cache.lock);
+
+    int rc = ferror(fid);
+    fclose(fid);
+    if (rc)
+        return liquid_error(LIQUID_EIO,"liquid_firdes_cache_save(), error writing '%s'", _filename);
+    return LIQUID_OK;
+}
+
+// load cache contents from binary file, adding to any existing entries
+int liquid_firdes_cache_load(const char * _filename)
+{
+    FILE * fid = fopen(_filename, "rb");
+    if (fid == NULL)
+        return liquid_error(LIQUID_EIO,"liquid_firdes_cache_load(), could not open '%s' for reading", _filename);
+
+    // validate header
+    char     magic[sizeof(LIQUID_FIRDES_CACHE_MAGIC)];
+    uint32_t version     = 0;
+    uint32_t num_entries = 0;
+    if (fread(magic,        1,                sizeof(magic), fid) != sizeof(magic) ||
+        fread(&version,     sizeof(uint32_t), 1,             fid) != 1             ||
+        fread(&num_entries, sizeof(uint32_t), 1,             fid) != 1             ||
+        memcmp(magic, LIQUID_FIRDES_CACHE_MAGIC, sizeof(magic)) != 0               ||
+        version != LIQUID_FIRDES_CACHE_VERSION)
+    {
+        fclose(fid);
+        return liquid_error(LIQUID_EIO,"liquid_firdes_cache_load(), '%s' is not a valid cache file", _filename);
+    }
+
+    // read entries
+    unsigned int i;
+    for (i=0; i<num_entries; i++) {
+        uint32_t key_len = 0;
+        uint32_t h_len   = 0;
+        if (fread(&key_len, sizeof(uint32_t), 1, fid) != 1 || key_len == 0 || key_len > 1<<16)
+            break;
+        unsigned char key[key_len];
+        if (fread(key, 1, key_len, fid) != key_len)
+            break;
+        if (fread(&h_len, sizeof(uint32_t), 1, fid) != 1 || h_len == 0 || h_len > 1<<24)
+            break;
+        float * h = (float*) malloc(h_len*sizeof(float));
+        if (fread(h, sizeof(float), h_len, fid) != h_len) {
+            free(h);
+            break;
+        }
+        liquid_firdes_cache_insert_entry(key, key_len, h, h_len);
+        free(h);
+    }
+    fclose(fid);
+
+    if (i != num_entries)
+        return liquid_error(LIQUID_EIO,"liquid_firdes_cache_load(), '%s' is truncated or corrupt", _filename);
+    return LIQUID_OK;
+}
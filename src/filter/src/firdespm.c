@@ -58,6 +58,13 @@
 #define LIQUID_FIRDESPM_DEBUG       0
 #define LIQUID_FIRDESPM_DEBUG_PRINT 0
 
+// default grid density (grid points per extremal frequency), minimum
+// density, and grid size bound used when selecting the density
+// automatically for long filters
+#define LIQUID_FIRDESPM_GRID_DENSITY     (20)
+#define LIQUID_FIRDESPM_GRID_DENSITY_MIN ( 8)
+#define LIQUID_FIRDESPM_GRID_SIZE_MAX    (4096)
+
 #define LIQUID_FIRDESPM_DEBUG_FILENAME "firdespm_internal_debug.m"
 #if LIQUID_FIRDESPM_DEBUG
 int firdespm_output_debug_file(firdespm _q);
@@ -70,12 +77,27 @@ int firdespm_init_memory(firdespm     _q,
                          unsigned int _num_bands);
 #endif
 
+// allocate memory for the grid according to the density and bands
+int firdespm_alloc_grid(firdespm _q);
+
 // initialize the frequency grid on the disjoint bounded set
 int firdespm_init_grid(firdespm _q);
 
 // compute interpolating polynomial
 int firdespm_compute_interp(firdespm _q);
 
+// compute barycentric weights, normalized to avoid underflow
+int firdespm_compute_barycentric(double *     _x,
+                                 unsigned int _n,
+                                 double *     _w);
+
+// evaluate barycentric interpolator away from interpolating points
+double firdespm_eval_barycentric(double *     _x,
+                                 double *     _wy,
+                                 double *     _w,
+                                 double       _x0,
+                                 unsigned int _n);
+
 // compute error signal from actual response (interpolator
 // output), desired response, and weights
 int firdespm_compute_error(firdespm _q);
@@ -99,7 +121,7 @@ struct firdespm_s {
     unsigned int r;             // number of approximating functions
     unsigned int num_bands;     // number of discrete bands
     unsigned int grid_size;     // number of points on the grid
-    unsigned int grid_density;  // density of the grid
+    unsigned int grid_density;  // density of the grid (grid points per extremum)
 
     // band type (e.g. LIQUID_FIRDESPM_BANDPASS)
     liquid_firdespm_btype btype;
@@ -115,10 +137,12 @@ struct firdespm_s {
     double * D;                 // desired response
     double * W;                 // weight
     double * E;                 // error
+    double * X;                 // cosine grid : cos(2*pi*F)
 
     double * x;                 // Chebyshev points : cos(2*pi*f)
     double * alpha;             // Lagrange interpolating polynomial
     double * c;                 // interpolants
+    double * ac;                // alpha .* c, for evaluation on the grid
     double rho;                 // extremal weighted error
 
     unsigned int * iext;        // indices of extrema
@@ -150,15 +174,36 @@ int firdespm_run(unsigned int            _h_len,
                  liquid_firdespm_btype   _btype,
                  float *                 _h)
 {
+    // pack design parameters into key and check design cache
+    unsigned int i;
+    float key[4 + 5*_num_bands];
+    key[0] = 1;
+    key[1] = (float)_h_len;
+    key[2] = (float)_num_bands;
+    key[3] = (float)_btype;
+    for (i=0; i<_num_bands; i++) {
+        key[4 + 5*i + 0] = _bands[2*i+0];
+        key[4 + 5*i + 1] = _bands[2*i+1];
+        key[4 + 5*i + 2] = _des[i];
+        key[4 + 5*i + 3] = _weights == NULL ? 1.0f : _weights[i];
+        key[4 + 5*i + 4] = _wtype   == NULL ? (float)LIQUID_FIRDESPM_FLATWEIGHT : (float)_wtype[i];
+    }
+    if (liquid_firdes_cache_lookup(key, sizeof(key), _h, _h_len))
+        return LIQUID_OK;
+
     // create object
     firdespm q = firdespm_create(_h_len,_num_bands,_bands,_des,_weights,_wtype,_btype);
+    if (q == NULL)
+        return liquid_error(LIQUID_EICONFIG,"firdespm_run(), could not create design object");
 
     // execute
     firdespm_execute(q,_h);
 
     // destroy
     firdespm_destroy(q);
-    return LIQUID_OK;
+
+    // store design in cache
+    return liquid_firdes_cache_insert(key, sizeof(key), _h, _h_len);
 }
 
 // run filter design for basic low-pass filter
@@ -258,6 +303,7 @@ firdespm firdespm_create(unsigned int            _h_len,
     q->x     = (double*) malloc((q->r+1)*sizeof(double));
     q->alpha = (double*) malloc((q->r+1)*sizeof(double));
     q->c     = (double*) malloc((q->r+1)*sizeof(double));
+    q->ac    = (double*) malloc((q->r+1)*sizeof(double));
 
     // allocate memory for arrays
     q->num_bands = _num_bands;
@@ -285,24 +331,12 @@ firdespm firdespm_create(unsigned int            _h_len,
         q->weights[i]   = _weights == NULL ? 1.0f : _weights[i];
     }
 
-    // estimate grid size
-    // TODO : adjust grid density based on expected value for rho
-    q->grid_density = 20;
-    q->grid_size = 0;
-    double df = 0.5/(q->grid_density*q->r); // frequency step
-    for (i=0; i<q->num_bands; i++) {
-        double f0 = q->bands[2*i+0];         // lower band edge
-        double f1 = q->bands[2*i+1];         // upper band edge
-        q->grid_size += (unsigned int)( (f1-f0)/df + 1.0 );
-    }
-
-    // create the grid
-    q->F = (double*) malloc(q->grid_size*sizeof(double));
-    q->D = (double*) malloc(q->grid_size*sizeof(double));
-    q->W = (double*) malloc(q->grid_size*sizeof(double));
-    q->E = (double*) malloc(q->grid_size*sizeof(double));
+    // create the grid; density is fixed so that designs do not depend on
+    // filter length (see firdespm_set_grid_density() for long filters)
+    q->grid_density = LIQUID_FIRDESPM_GRID_DENSITY;
     q->callback = NULL;
     q->userdata = NULL;
+    firdespm_alloc_grid(q);
     firdespm_init_grid(q);
     // TODO : fix grid, weights according to filter type
 
@@ -361,6 +395,7 @@ firdespm firdespm_create_callback(unsigned int          _h_len,
     q->x     = (double*) malloc((q->r+1)*sizeof(double));
     q->alpha = (double*) malloc((q->r+1)*sizeof(double));
     q->c     = (double*) malloc((q->r+1)*sizeof(double));
+    q->ac    = (double*) malloc((q->r+1)*sizeof(double));
 
     // allocate memory for arrays
     q->num_bands = _num_bands;
@@ -377,22 +412,10 @@ firdespm firdespm_create_callback(unsigned int          _h_len,
         q->weights[i]   = 0.0f;
     }
 
-    // estimate grid size
-    // TODO : adjust grid density based on expected value for rho
-    q->grid_density = 20;
-    q->grid_size = 0;
-    double df = 0.5/(q->grid_density*q->r); // frequency step
-    for (i=0; i<q->num_bands; i++) {
-        double f0 = q->bands[2*i+0];         // lower band edge
-        double f1 = q->bands[2*i+1];         // upper band edge
-        q->grid_size += (unsigned int)( (f1-f0)/df + 1.0 );
-    }
-
-    // create the grid
-    q->F = (double*) malloc(q->grid_size*sizeof(double));
-    q->D = (double*) malloc(q->grid_size*sizeof(double));
-    q->W = (double*) malloc(q->grid_size*sizeof(double));
-    q->E = (double*) malloc(q->grid_size*sizeof(double));
+    // create the grid; density is fixed so that designs do not depend on
+    // filter length (see firdespm_set_grid_density() for long filters)
+    q->grid_density = LIQUID_FIRDESPM_GRID_DENSITY;
+    firdespm_alloc_grid(q);
     firdespm_init_grid(q);
     // TODO : fix grid, weights according to filter type
 
@@ -422,12 +445,14 @@ firdespm firdespm_copy(firdespm q_orig)
     q_copy->D = (double*) liquid_malloc_copy(q_copy->D, q_orig->grid_size, sizeof(double));
     q_copy->W = (double*) liquid_malloc_copy(q_copy->W, q_orig->grid_size, sizeof(double));
     q_copy->E = (double*) liquid_malloc_copy(q_copy->E, q_orig->grid_size, sizeof(double));
+    q_copy->X = (double*) liquid_malloc_copy(q_copy->X, q_orig->grid_size, sizeof(double));
 
     // copy memory for extremal frequency set, interpolating polynomial
     q_copy->iext  = (unsigned int*) liquid_malloc_copy(q_copy->iext, q_orig->r+1,sizeof(unsigned int));
     q_copy->x     = (double*)       liquid_malloc_copy(q_copy->x,    q_orig->r+1,sizeof(double));
     q_copy->alpha = (double*)       liquid_malloc_copy(q_copy->alpha,q_orig->r+1,sizeof(double));
     q_copy->c     = (double*)       liquid_malloc_copy(q_copy->c,    q_orig->r+1,sizeof(double));
+    q_copy->ac    = (double*)       liquid_malloc_copy(q_copy->ac,   q_orig->r+1,sizeof(double));
 
     return q_copy;
 }
@@ -444,12 +469,14 @@ int firdespm_destroy(firdespm _q)
     free(_q->x);
     free(_q->alpha);
     free(_q->c);
+    free(_q->ac);
 
     // free dense grid elements
     free(_q->F);
     free(_q->D);
     free(_q->W);
     free(_q->E);
+    free(_q->X);
 
     // free band description elements
     free(_q->bands);
@@ -488,6 +515,39 @@ int firdespm_print(firdespm _q)
     return LIQUID_OK;
 }
 
+// set grid density (number of grid points per extremal frequency) and
+// re-build the grid; a value of zero selects the density automatically,
+// reducing it for long filters to bound the grid size
+int firdespm_set_grid_density(firdespm     _q,
+                              unsigned int _density)
+{
+    if (_density > 0 && _density < LIQUID_FIRDESPM_GRID_DENSITY_MIN)
+        return liquid_error(LIQUID_EICONFIG,"firdespm_set_grid_density(), density must be zero (automatic) or at least %u",
+                LIQUID_FIRDESPM_GRID_DENSITY_MIN);
+
+    if (_density == 0) {
+        _density = LIQUID_FIRDESPM_GRID_SIZE_MAX / _q->r;
+        if (_density > LIQUID_FIRDESPM_GRID_DENSITY)     _density = LIQUID_FIRDESPM_GRID_DENSITY;
+        if (_density < LIQUID_FIRDESPM_GRID_DENSITY_MIN) _density = LIQUID_FIRDESPM_GRID_DENSITY_MIN;
+    }
+
+    // release old grid and create new one
+    free(_q->F);
+    free(_q->D);
+    free(_q->W);
+    free(_q->E);
+    free(_q->X);
+    _q->grid_density = _density;
+    firdespm_alloc_grid(_q);
+    return firdespm_init_grid(_q);
+}
+
+// get grid density (number of grid points per extremal frequency)
+unsigned int firdespm_get_grid_density(firdespm _q)
+{
+    return _q->grid_density;
+}
+
 // execute filter design, storing result in _h
 int firdespm_execute(firdespm _q, float * _h)
 {
@@ -542,6 +602,28 @@ int firdespm_init_memory(firdespm     _q,
 }
 #endif
 
+// allocate memory for the grid according to the density and bands
+int firdespm_alloc_grid(firdespm _q)
+{
+    // estimate grid size
+    unsigned int i;
+    double df = 0.5/(_q->grid_density*_q->r); // frequency step
+    _q->grid_size = 0;
+    for (i=0; i<_q->num_bands; i++) {
+        double f0 = _q->bands[2*i+0];        // lower band edge
+        double f1 = _q->bands[2*i+1];        // upper band edge
+        _q->grid_size += (unsigned int)( (f1-f0)/df + 1.0 );
+    }
+
+    // create the grid
+    _q->F = (double*) malloc(_q->grid_size*sizeof(double));
+    _q->D = (double*) malloc(_q->grid_size*sizeof(double));
+    _q->W = (double*) malloc(_q->grid_size*sizeof(double));
+    _q->E = (double*) malloc(_q->grid_size*sizeof(double));
+    _q->X = (double*) malloc(_q->grid_size*sizeof(double));
+    return LIQUID_OK;
+}
+
 // initialize the frequency grid on the disjoint bounded set
 int firdespm_init_grid(firdespm _q)
 {
@@ -623,6 +705,10 @@ int firdespm_init_grid(firdespm _q)
     }
     _q->grid_size = n;
 
+    // compute cosine grid once rather than on every iteration
+    for (i=0; i<_q->grid_size; i++)
+        _q->X[i] = cos(2*M_PI*_q->F[i]);
+
     // take care of special symmetry conditions here
     if (_q->btype == LIQUID_FIRDESPM_BANDPASS) {
         if (_q->s == 0) {
@@ -653,6 +739,86 @@ int firdespm_init_grid(firdespm _q)
     return LIQUID_OK;
 }
 
+// compute barycentric weights for Lagrange interpolation; equivalent to
+// poly_fit_lagrange_barycentric() but the exponent of each product is
+// accumulated separately so that it neither underflows nor overflows for
+// long filters, where the interval [-1,1] holds many points. The weights
+// are normalized such that the largest has a magnitude in (1,2].
+int firdespm_compute_barycentric(double *     _x,
+                                 unsigned int _n,
+                                 double *     _w)
+{
+    unsigned int j, k;
+    int exponent[_n];   // base-2 exponent of each weight
+    int emax = 0;       // maximum exponent
+    int ek;
+    for (j=0; j<_n; j++) {
+        double m = 1.;  // running product (mantissa)
+        int    e = 0;   // running product (exponent)
+        for (k=0; k<_n; k++) {
+            if (j==k) continue;
+            m *= _x[j] - _x[k];
+
+            // periodically move exponent out of product
+            if ((k & 15) == 15) {
+                m  = frexp(m, &ek);
+                e += ek;
+            }
+        }
+        m  = frexp(m, &ek);
+        e += ek;
+
+        // add minuscule margin for coincident points
+        if (m == 0.0) m = 1.0e-9;
+
+        // invert: weight is (1/m) * 2^(-e)
+        _w[j]       = 1. / m;
+        exponent[j] = -e;
+        if (j==0 || exponent[j] > emax)
+            emax = exponent[j];
+    }
+
+    // normalize relative to largest weight
+    for (j=0; j<_n; j++)
+        _w[j] = ldexp(_w[j], exponent[j] - emax);
+    return LIQUID_OK;
+}
+
+// evaluate Lagrange polynomial (barycentric form) at _x0 which is known not
+// to coincide with any interpolating point; the sums are split across four
+// independent accumulators so that the loop can be vectorized
+//  _x      : interpolating points, [size: _n x 1]
+//  _wy     : weights multiplied by values at _x, [size: _n x 1]
+//  _w      : barycentric weights, [size: _n x 1]
+//  _x0     : evaluation point
+//  _n      : number of points
+double firdespm_eval_barycentric(double *     _x,
+                                 double *     _wy,
+                                 double *     _w,
+                                 double       _x0,
+                                 unsigned int _n)
+{
+    double t0[4] = {0., 0., 0., 0.};    // numerator sums
+    double t1[4] = {0., 0., 0., 0.};    // denominator sums
+    double g[4];                        // 1 / (_x0 - _x[j])
+    unsigned int j, l;
+    unsigned int m = _n & ~3u;
+    for (j=0; j<m; j+=4) {
+        for (l=0; l<4; l++) {
+            g[l]   = 1.0 / (_x0 - _x[j+l]);
+            t0[l] += _wy[j+l] * g[l];
+            t1[l] += _w [j+l] * g[l];
+        }
+    }
+    for ( ; j<_n; j++) {
+        g[0]   = 1.0 / (_x0 - _x[j]);
+        t0[0] += _wy[j] * g[0];
+        t1[0] += _w [j] * g[0];
+    }
+    return ((t0[0] + t0[1]) + (t0[2] + t0[3])) /
+           ((t1[0] + t1[1]) + (t1[2] + t1[3]));
+}
+
 // compute interpolating polynomial
 int firdespm_compute_interp(firdespm _q)
 {
@@ -660,7 +826,7 @@ int firdespm_compute_interp(firdespm _q)
 
     // compute Chebyshev points on F[iext[]] : cos(2*pi*f)
     for (i=0; i<_q->r+1; i++) {
-        _q->x[i] = cos(2*M_PI*_q->F[_q->iext[i]]);
+        _q->x[i] = _q->X[_q->iext[i]];
 #if LIQUID_FIRDESPM_DEBUG_PRINT
         printf("x[%3u] = %12.8f\n", i, _q->x[i]);
 #endif
@@ -668,7 +834,7 @@ int firdespm_compute_interp(firdespm _q)
     //printf("\n");
 
     // compute Lagrange interpolating polynomial
-    poly_fit_lagrange_barycentric(_q->x,_q->r+1,_q->alpha);
+    firdespm_compute_barycentric(_q->x,_q->r+1,_q->alpha);
 #if LIQUID_FIRDESPM_DEBUG_PRINT
     for (i=0; i<_q->r+1; i++)
         printf("a[%3u] = %12.8f\n", i, _q->alpha[i]);
@@ -691,6 +857,7 @@ int firdespm_compute_interp(firdespm _q)
     // compute polynomial values (interpolants)
     for (i=0; i<_q->r+1; i++) {
         _q->c[i] = _q->D[_q->iext[i]] - (i % 2 ? -1 : 1) * _q->rho / _q->W[_q->iext[i]];
+        _q->ac[i] = _q->alpha[i] * _q->c[i];
 #if LIQUID_FIRDESPM_DEBUG_PRINT
         printf("c[%3u] = %16.8e\n", i, _q->c[i]);
 #endif
@@ -698,16 +865,37 @@ int firdespm_compute_interp(firdespm _q)
     return LIQUID_OK;
 }
 
+// compute error signal from actual response (interpolator
+// output), desired response, and weights
 int firdespm_compute_error(firdespm _q)
 {
     unsigned int i;
+    int          n = _q->r + 1; // number of interpolating points
+    int          k = -1;        // last extremum at or below grid index
+    int          j;
+    double       tol = 1e-6f;   // exact-fit tolerance
 
     double xf;
     double H;
     for (i=0; i<_q->grid_size; i++) {
+        xf = _q->X[i];
+
+        // The grid is monotonic in x, as are the (sorted) extrema, so the
+        // interpolating points which are within the exact-fit tolerance of
+        // xf form a contiguous run adjacent to index k. Resolve these here
+        // to keep the inner evaluation loop free of branches, returning the
+        // first such point as poly_val_lagrange_barycentric() does.
+        while (k+1 < n && _q->iext[k+1] <= i)
+            k++;
+        j = -1;
+        if (k >= 0 && _q->x[k] - xf < tol) {
+            for (j=k; j>0 && _q->x[j-1] - xf < tol; j--);
+        } else if (k+1 < n && xf - _q->x[k+1] < tol) {
+            j = k+1;
+        }
+
         // compute actual response
-        xf = cos(2*M_PI*_q->F[i]);
-        H = poly_val_lagrange_barycentric(_q->x,_q->c,_q->alpha,xf,_q->r+1);
+        H = j >= 0 ? _q->c[j] : firdespm_eval_barycentric(_q->x,_q->ac,_q->alpha,xf,n);
 
         // compute error
         _q->E[i] = _q->W[i] * (_q->D[i] - H);
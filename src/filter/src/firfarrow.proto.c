@@ -44,6 +44,11 @@
 
 int FIRFARROW(_genpoly)(FIRFARROW() _q);
 
+// evaluate filter taps at fractional delay _mu
+int FIRFARROW(_eval_taps)(FIRFARROW() _q,
+                          float       _mu,
+                          TC *        _h);
+
 struct FIRFARROW(_s) {
     TC * h;             // filter coefficients
     unsigned int h_len; // filter length
@@ -53,7 +58,9 @@ struct FIRFARROW(_s) {
 
     float mu;           // fractional sample delay
     float * P;          // polynomail coefficients matrix [ h_len x Q+1 ]
+    float * Pt;         // transposed polynomial matrix [ Q x h_len ]
     float gamma;        // inverse of DC response (normalization factor)
+    DOTPROD() * dp;     // per-order sub-filters for time-varying delay [Q]
 
 #if FIRFARROW_USE_DOTPROD
     WINDOW() w;
@@ -101,8 +108,11 @@ FIRFARROW() FIRFARROW(_create)(unsigned int _h_len,
     q->v = malloc((q->h_len)*sizeof(TI));
 #endif
 
-    // allocate memory for polynomial matrix [ h_len x Q+1 ]
-    q->P = (float*) malloc((q->h_len)*(q->Q+1)*sizeof(float));
+    // allocate memory for polynomial matrix [ h_len x Q+1 ] and its
+    // transpose, grouping coefficients of each order across all taps
+    q->P  = (float*) malloc((q->h_len)*(q->Q+1)*sizeof(float));
+    q->Pt = (float*) malloc((q->h_len)*(q->Q+1)*sizeof(float));
+    q->dp = (DOTPROD()*) malloc((q->Q)*sizeof(DOTPROD()));
 
     // reset the filter object
     FIRFARROW(_reset)(q);
@@ -111,7 +121,8 @@ FIRFARROW() FIRFARROW(_create)(unsigned int _h_len,
     FIRFARROW(_genpoly)(q);
 
     // set nominal delay of 0
-    FIRFARROW(_set_delay)(q,0.0f);
+    q->mu = 0.0f;
+    FIRFARROW(_eval_taps)(q, q->mu, q->h);
 
     // return main object
     return q;
@@ -125,8 +136,13 @@ int FIRFARROW(_destroy)(FIRFARROW() _q)
 #else
     free(_q->v);
 #endif
+    unsigned int i;
+    for (i=0; i<_q->Q; i++)
+        DOTPROD(_destroy)(_q->dp[i]);
+    free(_q->dp);   // free the sub-filter array
     free(_q->h);    // free the filter coefficients array
     free(_q->P);    // free the polynomial matrix
+    free(_q->Pt);   // free the transposed polynomial matrix
 
     // free main object
     free(_q);
@@ -198,23 +214,15 @@ int FIRFARROW(_set_delay)(FIRFARROW() _q,
 {
     // validate input
     if (_mu < -1.0f || _mu > 1.0f) {
-        return liquid_error(LIQUID_EIVAL,"firfarrow_%s_create(), delay must be in [-1,1]\n", EXTENSION_FULL);
+        return liquid_error(LIQUID_EIVAL,"firfarrow_%s_set_delay(), delay must be in [-1,1]", EXTENSION_FULL);
     }
 
-    unsigned int i, n=0;
-    for (i=0; i<_q->h_len; i++) {
-        // compute filter tap from polynomial using negative
-        // value for _mu
-        _q->h[i] = POLY(_val)(_q->P+n, _q->Q, -_mu);
-
-        // normalize filter by inverse of DC response
-        _q->h[i] *= _q->gamma;
-
-        n += _q->Q+1;
+    // taps are cached and only re-computed when the delay changes
+    if (_mu == _q->mu)
+        return LIQUID_OK;
 
-        //printf("  h[%3u] = %12.8f\n", i, _q->h[i]);
-    }
-    return LIQUID_OK;
+    _q->mu = _mu;
+    return FIRFARROW(_eval_taps)(_q, _q->mu, _q->h);
 }
 
 // execute firfarrow internal dot product
@@ -260,6 +268,55 @@ int FIRFARROW(_execute_block)(FIRFARROW()  _q,
     return LIQUID_OK;
 }
 
+// compute firfarrow filter on block of samples with a different
+// fractional delay for each; the input and output arrays may have the
+// same pointer. The polynomial is evaluated on the outputs of the
+// per-order sub-filters (Farrow structure) rather than on the taps, so
+// no coefficients are re-computed. The delay set with set_delay() is
+// not modified.
+//  _q      : firfarrow object
+//  _x      : input array [size: _n x 1]
+//  _mu     : fractional sample delay array, each in [-1,1] [size: _n x 1]
+//  _n      : input, output array size
+//  _y      : output array [size: _n x 1]
+int FIRFARROW(_execute_block_delay)(FIRFARROW()  _q,
+                                    TI *         _x,
+                                    float *      _mu,
+                                    unsigned int _n,
+                                    TO *         _y)
+{
+    unsigned int i;
+    int k;
+    TI * r;
+    TO   v;
+    for (i=0; i<_n; i++) {
+        if (_mu[i] < -1.0f || _mu[i] > 1.0f)
+            return liquid_error(LIQUID_EIVAL,"firfarrow_%s_execute_block_delay(), delay must be in [-1,1]", EXTENSION_FULL);
+
+        // push input sample
+        FIRFARROW(_push)(_q, _x[i]);
+#if FIRFARROW_USE_DOTPROD
+        WINDOW(_read)(_q->w, &r);
+#else
+        // linearize circular buffer
+        TI buf[_q->h_len];
+        unsigned int j;
+        for (j=0; j<_q->h_len; j++)
+            buf[j] = _q->v[ (j+_q->v_index)%(_q->h_len) ];
+        r = buf;
+#endif
+
+        // evaluate polynomial in -mu on sub-filter outputs (Horner)
+        TO y = 0;
+        for (k=_q->Q-1; k>=0; k--) {
+            DOTPROD(_execute)(_q->dp[k], r, &v);
+            y = y*(-_mu[i]) + v;
+        }
+        _y[i] = y * _q->gamma;
+    }
+    return LIQUID_OK;
+}
+
 // get length of firfarrow object (number of filter taps)
 unsigned int FIRFARROW(_get_length)(FIRFARROW() _q)
 {
@@ -369,10 +426,20 @@ int FIRFARROW(_genpoly)(FIRFARROW() _q)
     }
 #endif
 
+    // transpose polynomial matrix
+    for (i=0; i<_q->h_len; i++) {
+        for (j=0; j<=_q->Q; j++)
+            _q->Pt[j*_q->h_len + i] = _q->P[i*(_q->Q+1) + j];
+    }
+
+    // create sub-filters for each polynomial order
+    for (j=0; j<_q->Q; j++)
+        _q->dp[j] = DOTPROD(_create)(_q->Pt + j*_q->h_len, _q->h_len);
+
     // normalize DC gain
-    _q->gamma = 1.0f;                // initialize gamma to 1
-    FIRFARROW(_set_delay)(_q,0.0f); // compute filter taps with zero delay
-    _q->gamma = 0.0f;                // clear gamma
+    _q->gamma = 1.0f;                       // initialize gamma to 1
+    FIRFARROW(_eval_taps)(_q, 0.0f, _q->h); // compute filter taps with zero delay
+    _q->gamma = 0.0f;                       // clear gamma
     for (i=0; i<_q->h_len; i++)      // compute DC response
         _q->gamma += _q->h[i];
     _q->gamma = 1.0f / (_q->gamma);   // invert result
@@ -380,3 +447,31 @@ int FIRFARROW(_genpoly)(FIRFARROW() _q)
     return LIQUID_OK;
 }
 
+
+// evaluate filter taps at fractional delay _mu; each tap is a polynomial
+// in -_mu, evaluated with Horner's method across all taps at once so
+// that the inner loop is over contiguous memory
+int FIRFARROW(_eval_taps)(FIRFARROW() _q,
+                          float       _mu,
+                          TC *        _h)
+{
+    // NOTE: only the first Q coefficients of each polynomial are used,
+    //       consistent with the original per-tap evaluation
+    unsigned int i;
+    int k;
+    float  x = -_mu;
+    float  h[_q->h_len];
+    float * p = _q->Pt + (_q->Q-1)*_q->h_len;
+    for (i=0; i<_q->h_len; i++)
+        h[i] = p[i];
+    for (k=_q->Q-2; k>=0; k--) {
+        p = _q->Pt + k*_q->h_len;
+        for (i=0; i<_q->h_len; i++)
+            h[i] = h[i]*x + p[i];
+    }
+
+    // normalize filter by inverse of DC response
+    for (i=0; i<_q->h_len; i++)
+        _h[i] = h[i] * _q->gamma;
+    return LIQUID_OK;
+}
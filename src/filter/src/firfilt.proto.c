@@ -70,7 +70,6 @@ FIRFILT() FIRFILT(_create)(TC * _h,
     // create filter object and initialize
     FIRFILT() q = (FIRFILT()) malloc(sizeof(struct FIRFILT(_s)));
     q->h_len = _n;
-    q->h = (TC *) malloc((q->h_len)*sizeof(TC));
 
 #if LIQUID_FIRFILT_USE_WINDOW
     // create window (internal buffer)
@@ -83,8 +82,8 @@ FIRFILT() FIRFILT(_create)(TC * _h,
     q->w_index = 0;
 #endif
 
-    // move coefficients
-    memmove(q->h, _h, (q->h_len)*sizeof(TC));
+    // copy coefficients, sharing read-only array with identical filters
+    q->h = (TC *) liquid_shared_malloc_copy(_h, q->h_len, sizeof(TC));
 
     // create dot product object with coefficients in reverse order
     q->dp = DOTPROD(_create_rev)(q->h, q->h_len);
@@ -256,13 +255,9 @@ FIRFILT() FIRFILT(_recreate)(FIRFILT() _q,
                              TC * _h,
                              unsigned int _n)
 {
-    unsigned int i;
-
-    // reallocate memory array if filter length has changed
+    // re-allocate buffer if filter length has changed
     if (_n != _q->h_len) {
-        // reallocate memory
         _q->h_len = _n;
-        _q->h = (TC*) realloc(_q->h, (_q->h_len)*sizeof(TC));
 
 #if LIQUID_FIRFILT_USE_WINDOW
         // recreate window object, preserving internal state
@@ -281,8 +276,14 @@ FIRFILT() FIRFILT(_recreate)(FIRFILT() _q,
     }
 
     // load filter in reverse order
+    TC h[_n];
+    unsigned int i;
     for (i=_n; i>0; i--)
-        _q->h[i-1] = _h[_n-i];
+        h[i-1] = _h[_n-i];
+
+    // replace coefficients, re-using the old array in place unless it is
+    // shared with other objects (_h may point to it, hence the copy above)
+    _q->h = (TC *) liquid_shared_realloc_copy(_q->h, h, _n, sizeof(TC));
 
     // re-create internal dot product object
     _q->dp = DOTPROD(_recreate)(_q->dp, _q->h, _q->h_len);
@@ -301,8 +302,8 @@ FIRFILT() FIRFILT(_copy)(FIRFILT() q_orig)
     FIRFILT() q_copy = (FIRFILT()) malloc(sizeof(struct FIRFILT(_s)));
     memmove(q_copy, q_orig, sizeof(struct FIRFILT(_s)));
 
-    // copy filter coefficients
-    q_copy->h = (TC *) liquid_malloc_copy(q_orig->h, q_orig->h_len, sizeof(TC));
+    // filter coefficients are read-only; share them
+    liquid_shared_retain(q_copy->h);
 
 #if LIQUID_FIRFILT_USE_WINDOW
     // copy window
@@ -326,7 +327,7 @@ int FIRFILT(_destroy)(FIRFILT() _q)
     free(_q->w);
 #endif
     DOTPROD(_destroy)(_q->dp);
-    free(_q->h);
+    liquid_shared_free(_q->h);
     free(_q);
     return LIQUID_OK;
 }
@@ -0,0 +1,328 @@
+/*
+ * Copyright (c) 2007 - 2025 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+//
+// Multi-channel finite impulse response filter. The same coefficients
+// are applied to a number of synchronous channels whose histories are
+// stored interleaved (one row of num_channels samples per time step) so
+// that each tap is applied to all channels in a single vectorizable loop.
+//
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+// defined:
+//  FIRFILT_MULTI() name-mangling macro
+//  TO              output type
+//  TC              coefficients type
+//  TI              input type
+
+// number of rows appended to history before it is compacted
+#define LIQUID_FIRFILT_MULTI_BLOCK_LEN (256)
+
+struct FIRFILT_MULTI(_s) {
+    unsigned int num_channels;  // number of channels
+    unsigned int h_len;         // filter length
+    TC *         h;             // filter coefficients [size: h_len x 1]
+
+    // interleaved history; row i holds sample i of every channel
+    TI *         buf;           // [size: (h_len-1+BLOCK_LEN) x num_channels]
+    unsigned int buf_rows;      // number of rows allocated
+    unsigned int row;           // index of next row to write
+
+    TO *         t;             // intermediate output [size: num_channels]
+    TC           scale;         // output scaling factor
+};
+
+// append one row of samples to history; _stride is the distance between
+// channels in the input
+int FIRFILT_MULTI(_push_row)(FIRFILT_MULTI() _q,
+                             TI *            _x,
+                             unsigned int    _stride);
+
+// compute one output row from most recent history into internal buffer
+int FIRFILT_MULTI(_compute_row)(FIRFILT_MULTI() _q);
+
+// create multi-channel firfilt object from external coefficients
+//  _h              :   filter coefficients [size: _h_len x 1]
+//  _h_len          :   filter length, _h_len > 0
+//  _num_channels   :   number of channels, _num_channels > 0
+FIRFILT_MULTI() FIRFILT_MULTI(_create)(TC *         _h,
+                                       unsigned int _h_len,
+                                       unsigned int _num_channels)
+{
+    // validate input
+    if (_h_len == 0)
+        return liquid_error_config("firfilt_multi_%s_create(), filter length must be greater than zero", EXTENSION_FULL);
+    if (_num_channels == 0)
+        return liquid_error_config("firfilt_multi_%s_create(), number of channels must be greater than zero", EXTENSION_FULL);
+
+    // create structure and initialize
+    FIRFILT_MULTI() q = (FIRFILT_MULTI()) malloc(sizeof(struct FIRFILT_MULTI(_s)));
+    q->h_len        = _h_len;
+    q->num_channels = _num_channels;
+    q->buf_rows     = q->h_len - 1 + LIQUID_FIRFILT_MULTI_BLOCK_LEN;
+
+    // allocate memory for coefficients and state
+    q->h   = (TC *) liquid_malloc_copy(_h, q->h_len, sizeof(TC));
+    q->buf = (TI *) malloc((q->buf_rows)*(q->num_channels)*sizeof(TI));
+    q->t   = (TO *) malloc((q->num_channels)*sizeof(TO));
+
+    // reset internal state, set scale and return
+    FIRFILT_MULTI(_reset)(q);
+    FIRFILT_MULTI(_set_scale)(q, 1);
+    return q;
+}
+
+// create multi-channel firfilt object using Kaiser-Bessel windowed sinc
+//  _n              :   filter length, _n > 0
+//  _fc             :   filter normalized cut-off frequency, 0 < _fc < 0.5
+//  _as             :   filter stop-band attenuation [dB], _as > 0
+//  _mu             :   fractional sample offset, -0.5 < _mu < 0.5
+//  _num_channels   :   number of channels, _num_channels > 0
+FIRFILT_MULTI() FIRFILT_MULTI(_create_kaiser)(unsigned int _n,
+                                              float        _fc,
+                                              float        _as,
+                                              float        _mu,
+                                              unsigned int _num_channels)
+{
+    // validate input before sizing temporary arrays
+    if (_n == 0)
+        return liquid_error_config("firfilt_multi_%s_create_kaiser(), filter length must be greater than zero", EXTENSION_FULL);
+    if (_num_channels == 0)
+        return liquid_error_config("firfilt_multi_%s_create_kaiser(), number of channels must be greater than zero", EXTENSION_FULL);
+
+    // compute temporary array for holding coefficients
+    float hf[_n];
+    if (liquid_firdes_kaiser(_n, _fc, _as, _mu, hf) != LIQUID_OK)
+        return liquid_error_config("firfilt_multi_%s_create_kaiser(), invalid config", EXTENSION_FULL);
+
+    // copy coefficients to type-specific array
+    TC h[_n];
+    unsigned int i;
+    for (i=0; i<_n; i++)
+        h[i] = (TC) hf[i];
+
+    return FIRFILT_MULTI(_create)(h, _n, _num_channels);
+}
+
+// copy object
+FIRFILT_MULTI() FIRFILT_MULTI(_copy)(FIRFILT_MULTI() q_orig)
+{
+    // validate input
+    if (q_orig == NULL)
+        return liquid_error_config("firfilt_multi_%s_copy(), object cannot be NULL", EXTENSION_FULL);
+
+    // create object, copy internal memory, overwrite with specific values
+    FIRFILT_MULTI() q_copy = (FIRFILT_MULTI()) malloc(sizeof(struct FIRFILT_MULTI(_s)));
+    memmove(q_copy, q_orig, sizeof(struct FIRFILT_MULTI(_s)));
+
+    // copy coefficients and state
+    q_copy->h   = (TC *) liquid_malloc_copy(q_orig->h,   q_orig->h_len, sizeof(TC));
+    q_copy->buf = (TI *) liquid_malloc_copy(q_orig->buf, q_orig->buf_rows*q_orig->num_channels, sizeof(TI));
+    q_copy->t   = (TO *) malloc(q_copy->num_channels*sizeof(TO));
+
+    // return object
+    return q_copy;
+}
+
+// destroy object, freeing all internal memory
+int FIRFILT_MULTI(_destroy)(FIRFILT_MULTI() _q)
+{
+    free(_q->h);
+    free(_q->buf);
+    free(_q->t);
+    free(_q);
+    return LIQUID_OK;
+}
+
+// print object internals
+int FIRFILT_MULTI(_print)(FIRFILT_MULTI() _q)
+{
+    printf("<liquid.firfilt_multi_%s", EXTENSION_FULL);
+    printf(", len=%u", _q->h_len);
+    printf(", channels=%u", _q->num_channels);
+    printf(">\n");
+    return LIQUID_OK;
+}
+
+// clear/reset internal state for all channels
+int FIRFILT_MULTI(_reset)(FIRFILT_MULTI() _q)
+{
+    memset(_q->buf, 0, (_q->buf_rows)*(_q->num_channels)*sizeof(TI));
+    _q->row = _q->h_len - 1;
+    return LIQUID_OK;
+}
+
+// clear/reset internal state for a single channel
+int FIRFILT_MULTI(_reset_channel)(FIRFILT_MULTI() _q,
+                                  unsigned int    _channel)
+{
+    if (_channel >= _q->num_channels)
+        return liquid_error(LIQUID_EIRANGE,"firfilt_multi_%s_reset_channel(), channel index (%u) out of range", EXTENSION_FULL, _channel);
+
+    unsigned int i;
+    for (i=0; i<_q->buf_rows; i++)
+        _q->buf[i*_q->num_channels + _channel] = 0;
+    return LIQUID_OK;
+}
+
+// get number of channels
+unsigned int FIRFILT_MULTI(_get_num_channels)(FIRFILT_MULTI() _q)
+{
+    return _q->num_channels;
+}
+
+// get filter length
+unsigned int FIRFILT_MULTI(_get_length)(FIRFILT_MULTI() _q)
+{
+    return _q->h_len;
+}
+
+// set scale value to be applied to each output sample
+int FIRFILT_MULTI(_set_scale)(FIRFILT_MULTI() _q, TC _scale)
+{
+    _q->scale = _scale;
+    return LIQUID_OK;
+}
+
+// get output scaling for filter
+int FIRFILT_MULTI(_get_scale)(FIRFILT_MULTI() _q, TC * _scale)
+{
+    *_scale = _q->scale;
+    return LIQUID_OK;
+}
+
+// execute filter on one sample from each channel; in-place operation
+// is permitted
+//  _q      :   filter object
+//  _x      :   input samples, one per channel [size: num_channels x 1]
+//  _y      :   output samples, one per channel [size: num_channels x 1]
+int FIRFILT_MULTI(_execute)(FIRFILT_MULTI() _q,
+                            TI *            _x,
+                            TO *            _y)
+{
+    FIRFILT_MULTI(_push_row)(_q, _x, 1);
+    FIRFILT_MULTI(_compute_row)(_q);
+    memmove(_y, _q->t, _q->num_channels*sizeof(TO));
+    return LIQUID_OK;
+}
+
+// execute filter on a block of samples stored in sample-major order;
+// in-place operation is permitted
+//  _q      :   filter object
+//  _x      :   input array, sample-major [size: _n x num_channels]
+//  _n      :   number of samples per channel
+//  _y      :   output array, sample-major [size: _n x num_channels]
+int FIRFILT_MULTI(_execute_block)(FIRFILT_MULTI() _q,
+                                  TI *            _x,
+                                  unsigned int    _n,
+                                  TO *            _y)
+{
+    unsigned int i;
+    for (i=0; i<_n; i++)
+        FIRFILT_MULTI(_execute)(_q, &_x[i*_q->num_channels], &_y[i*_q->num_channels]);
+    return LIQUID_OK;
+}
+
+// execute filter on a block of samples stored in channel-major order;
+// in-place operation is permitted
+//  _q      :   filter object
+//  _x      :   input array, channel-major [size: num_channels x _n]
+//  _n      :   number of samples per channel
+//  _y      :   output array, channel-major [size: num_channels x _n]
+int FIRFILT_MULTI(_execute_block_channel_major)(FIRFILT_MULTI() _q,
+                                                TI *            _x,
+                                                unsigned int    _n,
+                                                TO *            _y)
+{
+    unsigned int i, c;
+    for (i=0; i<_n; i++) {
+        // gather row from each channel, compute, and scatter output
+        FIRFILT_MULTI(_push_row)(_q, &_x[i], _n);
+        FIRFILT_MULTI(_compute_row)(_q);
+        for (c=0; c<_q->num_channels; c++)
+            _y[c*_n + i] = _q->t[c];
+    }
+    return LIQUID_OK;
+}
+
+//
+// internal methods
+//
+
+// append one row of samples to history; _stride is the distance between
+// channels in the input
+int FIRFILT_MULTI(_push_row)(FIRFILT_MULTI() _q,
+                             TI *            _x,
+                             unsigned int    _stride)
+{
+    unsigned int M = _q->num_channels;
+
+    // compact history once buffer is full, retaining the most recent
+    // h_len-1 rows
+    if (_q->row == _q->buf_rows) {
+        unsigned int p = _q->h_len - 1;
+        memmove(_q->buf, _q->buf + (_q->row - p)*M, p*M*sizeof(TI));
+        _q->row = p;
+    }
+
+    // write new row
+    TI * r = _q->buf + _q->row*M;
+    unsigned int c;
+    if (_stride == 1) {
+        memmove(r, _x, M*sizeof(TI));
+    } else {
+        for (c=0; c<M; c++)
+            r[c] = _x[c*_stride];
+    }
+    _q->row++;
+    return LIQUID_OK;
+}
+
+// compute one output row from most recent history into internal buffer
+int FIRFILT_MULTI(_compute_row)(FIRFILT_MULTI() _q)
+{
+    unsigned int M = _q->num_channels;
+    unsigned int c, k;
+    TO * t = _q->t;
+
+    // newest sample is multiplied by h[0]; each tap is applied across
+    // all channels in a loop with no dependency between iterations
+    TI * r = _q->buf + (_q->row - 1)*M;
+    TC h0 = _q->h[0];
+    for (c=0; c<M; c++)
+        t[c] = h0 * r[c];
+    for (k=1; k<_q->h_len; k++) {
+        TC hk = _q->h[k];
+        r -= M;
+        for (c=0; c<M; c++)
+            t[c] += hk * r[c];
+    }
+
+    // apply scaling
+    for (c=0; c<M; c++)
+        t[c] *= _q->scale;
+    return LIQUID_OK;
+}
@@ -27,6 +27,10 @@
 #include <stdlib.h>
 #include <math.h>
 
+// maximum number of samples per stream processed in each pass of the
+// block methods
+#define FIRHILB_BLOCK_LEN (256)
+
 struct FIRHILB(_s) {
     T * h;                  // filter coefficients
     T complex * hc;         // filter coefficients (complex)
@@ -52,8 +56,21 @@ struct FIRHILB(_s) {
 
     // regular real-to-complex/complex-to-real operation
     unsigned int toggle;
+
+    // contiguous history buffers for block operation, one for each window
+    // [size: 4 x (2*m + FIRHILB_BLOCK_LEN)]
+    T * b;
 };
 
+// load window history into start of block buffer _b
+int FIRHILB(_block_load)(FIRHILB() _q, WINDOW() _w, T * _b);
+
+// store latest _n samples of block buffer _b into window
+int FIRHILB(_block_store)(FIRHILB() _q, WINDOW() _w, T * _b, unsigned int _n);
+
+// get block buffer for stream _i (0 <= _i < 4)
+#define FIRHILB_BLOCK_BUF(_q,_i) ((_q)->b + (_i)*(2*(_q)->m + FIRHILB_BLOCK_LEN))
+
 // create firhilb object
 //  _m      :   filter semi-length (delay: 2*m+1)
 //  _as     :   stop-band attenuation [dB]
@@ -103,6 +120,9 @@ FIRHILB() FIRHILB(_create)(unsigned int _m,
     // create internal dot product object
     q->dpq = DOTPROD(_create)(q->hq, q->hq_len);
 
+    // allocate block buffers
+    q->b = (T *) malloc(4*(2*q->m + FIRHILB_BLOCK_LEN)*sizeof(T));
+
     // reset internal state and return object
     FIRHILB(_reset)(q);
     return q;
@@ -129,6 +149,9 @@ FIRHILB() FIRHILB(_copy)(FIRHILB() q_orig)
     q_copy->w2  = WINDOW (_copy)(q_orig->w2 );
     q_copy->w3  = WINDOW (_copy)(q_orig->w3 );
     q_copy->dpq = DOTPROD(_copy)(q_orig->dpq);
+
+    // block buffers hold no state between calls
+    q_copy->b = (T *) malloc(4*(2*q_orig->m + FIRHILB_BLOCK_LEN)*sizeof(T));
     return q_copy;
 }
 
@@ -148,6 +171,7 @@ int FIRHILB(_destroy)(FIRHILB() _q)
     free(_q->h);
     free(_q->hc);
     free(_q->hq);
+    free(_q->b);
 
     // free main object memory
     free(_q);
@@ -268,6 +292,134 @@ int FIRHILB(_c2r_execute)(FIRHILB() _q,
     return LIQUID_OK;
 }
 
+// execute Hilbert transform (real to complex) on a block of samples;
+// the even and odd input phases are separated into contiguous buffers
+// so that the filter branch is one dot product per output directly on
+// the history and the delay branch is a copy
+//  _q      :   firhilb object
+//  _x      :   real-valued input array [size: _n x 1]
+//  _n      :   number of input, output samples
+//  _y      :   complex-valued output array [size: _n x 1]
+int FIRHILB(_r2c_execute_block)(FIRHILB()    _q,
+                                T *          _x,
+                                unsigned int _n,
+                                T complex *  _y)
+{
+    // align to even phase
+    if (_n > 0 && _q->toggle) {
+        FIRHILB(_r2c_execute)(_q, _x[0], _y);
+        _x++; _y++; _n--;
+    }
+
+    unsigned int m  = _q->m;
+    T * b0 = FIRHILB_BLOCK_BUF(_q,0);   // samples for w0 (even phase)
+    T * b1 = FIRHILB_BLOCK_BUF(_q,1);   // samples for w1 (odd phase)
+    T yq;
+    unsigned int i;
+    while (_n >= 2) {
+        unsigned int k = _n/2 < FIRHILB_BLOCK_LEN ? _n/2 : FIRHILB_BLOCK_LEN;
+
+        // load history and de-interleave input
+        FIRHILB(_block_load)(_q, _q->w0, b0);
+        FIRHILB(_block_load)(_q, _q->w1, b1);
+        for (i=0; i<k; i++) {
+            b0[2*m+i] = _x[2*i+0];
+            b1[2*m+i] = _x[2*i+1];
+        }
+
+        // compute outputs
+        for (i=0; i<k; i++) {
+            DOTPROD(_execute)(_q->dpq, b1+i, &yq);
+            _y[2*i+0] = b0[i+m] + _Complex_I * yq;
+
+            DOTPROD(_execute)(_q->dpq, b0+i+1, &yq);
+            _y[2*i+1] = b1[i+m] + _Complex_I * yq;
+        }
+
+        // update state
+        FIRHILB(_block_store)(_q, _q->w0, b0, k);
+        FIRHILB(_block_store)(_q, _q->w1, b1, k);
+        _x += 2*k;
+        _y += 2*k;
+        _n -= 2*k;
+    }
+
+    // trailing sample
+    if (_n > 0)
+        FIRHILB(_r2c_execute)(_q, _x[0], _y);
+    return LIQUID_OK;
+}
+
+// execute Hilbert transform (complex to real) on a block of samples
+//  _q      :   firhilb object
+//  _x      :   complex-valued input array [size: _n x 1]
+//  _n      :   number of input, output samples
+//  _y0     :   real-valued output array, lower side-band retained [size: _n x 1]
+//  _y1     :   real-valued output array, upper side-band retained [size: _n x 1]
+int FIRHILB(_c2r_execute_block)(FIRHILB()    _q,
+                                T complex *  _x,
+                                unsigned int _n,
+                                T *          _y0,
+                                T *          _y1)
+{
+    // align to even phase
+    if (_n > 0 && _q->toggle) {
+        FIRHILB(_c2r_execute)(_q, _x[0], _y0, _y1);
+        _x++; _y0++; _y1++; _n--;
+    }
+
+    unsigned int m  = _q->m;
+    T * b0 = FIRHILB_BLOCK_BUF(_q,0);   // real, even phase (w0)
+    T * b1 = FIRHILB_BLOCK_BUF(_q,1);   // imag, even phase (w1)
+    T * b2 = FIRHILB_BLOCK_BUF(_q,2);   // real, odd phase  (w2)
+    T * b3 = FIRHILB_BLOCK_BUF(_q,3);   // imag, odd phase  (w3)
+    T yi, yq;
+    unsigned int i;
+    while (_n >= 2) {
+        unsigned int k = _n/2 < FIRHILB_BLOCK_LEN ? _n/2 : FIRHILB_BLOCK_LEN;
+
+        // load history and de-interleave input
+        FIRHILB(_block_load)(_q, _q->w0, b0);
+        FIRHILB(_block_load)(_q, _q->w1, b1);
+        FIRHILB(_block_load)(_q, _q->w2, b2);
+        FIRHILB(_block_load)(_q, _q->w3, b3);
+        for (i=0; i<k; i++) {
+            b0[2*m+i] = crealf(_x[2*i+0]);
+            b1[2*m+i] = cimagf(_x[2*i+0]);
+            b2[2*m+i] = crealf(_x[2*i+1]);
+            b3[2*m+i] = cimagf(_x[2*i+1]);
+        }
+
+        // compute outputs
+        for (i=0; i<k; i++) {
+            yi = b0[i+m];
+            DOTPROD(_execute)(_q->dpq, b3+i, &yq);
+            _y0[2*i+0] = yi + yq;
+            _y1[2*i+0] = yi - yq;
+
+            yi = b2[i+m];
+            DOTPROD(_execute)(_q->dpq, b1+i+1, &yq);
+            _y0[2*i+1] = yi + yq;
+            _y1[2*i+1] = yi - yq;
+        }
+
+        // update state
+        FIRHILB(_block_store)(_q, _q->w0, b0, k);
+        FIRHILB(_block_store)(_q, _q->w1, b1, k);
+        FIRHILB(_block_store)(_q, _q->w2, b2, k);
+        FIRHILB(_block_store)(_q, _q->w3, b3, k);
+        _x  += 2*k;
+        _y0 += 2*k;
+        _y1 += 2*k;
+        _n  -= 2*k;
+    }
+
+    // trailing sample
+    if (_n > 0)
+        FIRHILB(_c2r_execute)(_q, _x[0], _y0, _y1);
+    return LIQUID_OK;
+}
+
 // execute Hilbert transform decimator (real to complex)
 //  _q      :   firhilb object
 //  _x      :   real-valued input array [size: 2 x 1]
@@ -309,11 +461,37 @@ int FIRHILB(_decim_execute_block)(FIRHILB()    _q,
                                   unsigned int _n,
                                   T complex *  _y)
 {
+    unsigned int m  = _q->m;
+    T * b0 = FIRHILB_BLOCK_BUF(_q,0);   // delay branch (w0)
+    T * b1 = FIRHILB_BLOCK_BUF(_q,1);   // filter branch (w1)
+    T yq;
     unsigned int i;
-    for (i=0; i<_n; i++) {
-        FIRHILB(_decim_execute)(_q, &_x[2*i], &_y[i]);
+    while (_n > 0) {
+        unsigned int k = _n < FIRHILB_BLOCK_LEN ? _n : FIRHILB_BLOCK_LEN;
+
+        // load history and de-interleave input
+        FIRHILB(_block_load)(_q, _q->w0, b0);
+        FIRHILB(_block_load)(_q, _q->w1, b1);
+        for (i=0; i<k; i++) {
+            b1[2*m+i] = _x[2*i+0];
+            b0[2*m+i] = _x[2*i+1];
+        }
+
+        // compute outputs, alternating sign
+        for (i=0; i<k; i++) {
+            DOTPROD(_execute)(_q->dpq, b1+i+1, &yq);
+            T complex v = b0[i+m] + _Complex_I * yq;
+            _y[i] = _q->toggle ? -v : v;
+            _q->toggle = 1 - _q->toggle;
+        }
+
+        // update state
+        FIRHILB(_block_store)(_q, _q->w0, b0, k);
+        FIRHILB(_block_store)(_q, _q->w1, b1, k);
+        _x += 2*k;
+        _y += k;
+        _n -= k;
     }
-
     return LIQUID_OK;
 }
 
@@ -356,10 +534,59 @@ int FIRHILB(_interp_execute_block)(FIRHILB()    _q,
                                    unsigned int _n,
                                    T *          _y)
 {
+    unsigned int m  = _q->m;
+    T * b0 = FIRHILB_BLOCK_BUF(_q,0);   // delay branch (w0)
+    T * b1 = FIRHILB_BLOCK_BUF(_q,1);   // filter branch (w1)
     unsigned int i;
-    for (i=0; i<_n; i++) {
-        FIRHILB(_interp_execute)(_q, _x[i], &_y[2*i]);
+    while (_n > 0) {
+        unsigned int k = _n < FIRHILB_BLOCK_LEN ? _n : FIRHILB_BLOCK_LEN;
+
+        // load history and input, alternating sign
+        FIRHILB(_block_load)(_q, _q->w0, b0);
+        FIRHILB(_block_load)(_q, _q->w1, b1);
+        for (i=0; i<k; i++) {
+            T complex v = _q->toggle ? -_x[i] : _x[i];
+            b0[2*m+i] = cimagf(v);
+            b1[2*m+i] = crealf(v);
+            _q->toggle = 1 - _q->toggle;
+        }
+
+        // compute outputs
+        for (i=0; i<k; i++) {
+            _y[2*i+0] = b0[i+m];
+            DOTPROD(_execute)(_q->dpq, b1+i+1, &_y[2*i+1]);
+        }
+
+        // update state
+        FIRHILB(_block_store)(_q, _q->w0, b0, k);
+        FIRHILB(_block_store)(_q, _q->w1, b1, k);
+        _x += k;
+        _y += 2*k;
+        _n -= k;
     }
+    return LIQUID_OK;
+}
 
+// load window history into start of block buffer _b
+int FIRHILB(_block_load)(FIRHILB() _q,
+                         WINDOW()  _w,
+                         T *       _b)
+{
+    T * r;
+    WINDOW(_read)(_w, &r);
+    memmove(_b, r, 2*_q->m*sizeof(T));
     return LIQUID_OK;
 }
+
+// store latest _n samples of block buffer _b into window; only the last
+// 2*m samples need to be pushed since the window holds no more than this
+int FIRHILB(_block_store)(FIRHILB()    _q,
+                          WINDOW()     _w,
+                          T *          _b,
+                          unsigned int _n)
+{
+    unsigned int len = 2*_q->m;
+    if (_n > len)
+        return WINDOW(_write)(_w, _b + _n, len);
+    return WINDOW(_write)(_w, _b + len, _n);
+}
@@ -657,6 +657,19 @@ int IIRFILT(_execute_block)(IIRFILT()    _q,
                             TO *         _y)
 {
     unsigned int i;
+    if (_q->type == IIRFILT_TYPE_SOS) {
+        // run each second-order section over the entire block with the
+        // look-ahead block method; output of one feeds the next
+        IIRFILTSOS(_execute_block)(_q->qsos[0], _x, _n, _y);
+        for (i=1; i<_q->nsos; i++)
+            IIRFILTSOS(_execute_block)(_q->qsos[i], _y, _n, _y);
+
+        // apply scaling
+        for (i=0; i<_n; i++)
+            _y[i] *= _q->scale;
+        return LIQUID_OK;
+    }
+
     for (i=0; i<_n; i++) {
         // compute output sample
         IIRFILT(_execute)(_q, _x[i], &_y[i]);
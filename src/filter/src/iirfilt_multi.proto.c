@@ -0,0 +1,328 @@
+/*
+ * Copyright (c) 2007 - 2025 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+//
+// Multi-channel infinite impulse response filter using second-order
+// sections. The same cascade is applied to a number of independent
+// channels whose states are stored contiguously so that the inner
+// loop runs across channels rather than across time.
+//
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+// defined:
+//  IIRFILT_MULTI() name-mangling macro
+//  TO              output type
+//  TC              coefficients type
+//  TI              input type
+//  PRINTVAL()      print macro(s)
+
+struct IIRFILT_MULTI(_s) {
+    unsigned int num_channels;  // number of independent channels
+    unsigned int nsos;          // number of second-order sections
+    TC *         b;             // feed-forward coefficients [size: nsos x 3]
+    TC *         a;             // feed-back coefficients    [size: nsos x 3]
+
+    // Direct form II state for each section, stored as two rows of
+    // num_channels elements: v[1] followed by v[2]
+    TO *         v;             // [size: nsos x 2 x num_channels]
+    TO *         t;             // intermediate buffer [size: num_channels]
+
+    TC           scale;         // output scaling factor
+};
+
+// create multi-channel iirfilt object based on second-order sections form
+//  _B              :   numerator, feed-forward coefficients [size: _nsos x 3]
+//  _A              :   denominator, feed-back coefficients  [size: _nsos x 3]
+//  _nsos           :   number of second-order sections
+//  _num_channels   :   number of independent channels
+IIRFILT_MULTI() IIRFILT_MULTI(_create_sos)(TC *         _B,
+                                           TC *         _A,
+                                           unsigned int _nsos,
+                                           unsigned int _num_channels)
+{
+    // validate input
+    if (_nsos == 0)
+        return liquid_error_config("iirfilt_multi_%s_create_sos(), filter must have at least one 2nd-order section", EXTENSION_FULL);
+    if (_num_channels == 0)
+        return liquid_error_config("iirfilt_multi_%s_create_sos(), number of channels must be greater than zero", EXTENSION_FULL);
+
+    // create structure and initialize
+    IIRFILT_MULTI() q = (IIRFILT_MULTI()) malloc(sizeof(struct IIRFILT_MULTI(_s)));
+    q->nsos         = _nsos;
+    q->num_channels = _num_channels;
+
+    // allocate memory for coefficients and state
+    q->b = (TC *) malloc(3*(q->nsos)*sizeof(TC));
+    q->a = (TC *) malloc(3*(q->nsos)*sizeof(TC));
+    q->v = (TO *) malloc(2*(q->nsos)*(q->num_channels)*sizeof(TO));
+    q->t = (TO *) malloc(  (q->num_channels)*sizeof(TO));
+
+    // copy coefficients, normalizing each section by a[0]
+    unsigned int i, k;
+    for (i=0; i<q->nsos; i++) {
+        TC a0 = _A[3*i];
+        for (k=0; k<3; k++) {
+            q->b[3*i+k] = _B[3*i+k] / a0;
+            q->a[3*i+k] = _A[3*i+k] / a0;
+        }
+    }
+
+    // reset internal state, set scale and return
+    IIRFILT_MULTI(_reset)(q);
+    IIRFILT_MULTI(_set_scale)(q, 1);
+    return q;
+}
+
+// create multi-channel iirfilt object from prototype; the filter is
+// always realized as cascaded second-order sections
+//  _ftype          :   filter type (e.g. LIQUID_IIRDES_BUTTER)
+//  _btype          :   band type (e.g. LIQUID_IIRDES_BANDPASS)
+//  _order          :   filter order
+//  _fc             :   low-pass prototype cut-off frequency
+//  _f0             :   center frequency (band-pass, band-stop)
+//  _ap             :   pass-band ripple in dB
+//  _as             :   stop-band ripple in dB
+//  _num_channels   :   number of independent channels
+IIRFILT_MULTI() IIRFILT_MULTI(_create_prototype)(liquid_iirdes_filtertype _ftype,
+                                                 liquid_iirdes_bandtype   _btype,
+                                                 unsigned int             _order,
+                                                 float                    _fc,
+                                                 float                    _f0,
+                                                 float                    _ap,
+                                                 float                    _as,
+                                                 unsigned int             _num_channels)
+{
+    // derived values : compute number of second-order sections; order
+    // effectively doubles for band-pass, band-stop filters
+    unsigned int N = _order;
+    if (_btype == LIQUID_IIRDES_BANDPASS ||
+        _btype == LIQUID_IIRDES_BANDSTOP)
+    {
+        N *= 2;
+    }
+    unsigned int r = N%2;       // odd/even order
+    unsigned int L = (N-r)/2;   // filter semi-length
+
+    // design filter (compute coefficients)
+    unsigned int h_len = 3*(L+r);
+    float B[h_len];
+    float A[h_len];
+    if (liquid_iirdes(_ftype, _btype, LIQUID_IIRDES_SOS, _order, _fc, _f0, _ap, _as, B, A) != LIQUID_OK)
+        return liquid_error_config("iirfilt_multi_%s_create_prototype(), could not design filter", EXTENSION_FULL);
+
+    // move coefficients to type-specific arrays (e.g. float complex)
+    TC Bc[h_len];
+    TC Ac[h_len];
+    unsigned int i;
+    for (i=0; i<h_len; i++) {
+        Bc[i] = B[i];
+        Ac[i] = A[i];
+    }
+
+    // create filter object
+    return IIRFILT_MULTI(_create_sos)(Bc, Ac, L+r, _num_channels);
+}
+
+// create simplified low-pass Butterworth multi-channel IIR filter
+//  _order          :   filter order
+//  _fc             :   low-pass prototype cut-off frequency
+//  _num_channels   :   number of independent channels
+IIRFILT_MULTI() IIRFILT_MULTI(_create_lowpass)(unsigned int _order,
+                                               float        _fc,
+                                               unsigned int _num_channels)
+{
+    return IIRFILT_MULTI(_create_prototype)(LIQUID_IIRDES_BUTTER,
+                                            LIQUID_IIRDES_LOWPASS,
+                                            _order,
+                                            _fc,
+                                            0.0f,      // center
+                                            0.1f,      // pass-band ripple
+                                            60.0f,     // stop-band attenuation
+                                            _num_channels);
+}
+
+// create multi-channel DC-blocking filter
+//
+//          1 -          z^-1
+//  H(z) = ------------------
+//          1 - (1-alpha)z^-1
+IIRFILT_MULTI() IIRFILT_MULTI(_create_dc_blocker)(float        _alpha,
+                                                  unsigned int _num_channels)
+{
+    // validate input
+    if (_alpha <= 0.0f)
+        return liquid_error_config("iirfilt_multi_%s_create_dc_blocker(), filter bandwidth must be greater than zero", EXTENSION_FULL);
+
+    // compute DC-blocking filter coefficients as a single section
+    TC b[3] = {(TC)1.0f, (TC)(-1.0f),         0};
+    TC a[3] = {(TC)1.0f, (TC)(-1.0f + _alpha), 0};
+    IIRFILT_MULTI() q = IIRFILT_MULTI(_create_sos)(b, a, 1, _num_channels);
+    if (q == NULL)
+        return NULL;
+
+    // adjust scale so maintain consistent gain across the band
+    IIRFILT_MULTI(_set_scale)(q, sqrt(1-_alpha));
+    return q;
+}
+
+// copy object
+IIRFILT_MULTI() IIRFILT_MULTI(_copy)(IIRFILT_MULTI() q_orig)
+{
+    // validate input
+    if (q_orig == NULL)
+        return liquid_error_config("iirfilt_multi_%s_copy(), object cannot be NULL", EXTENSION_FULL);
+
+    // create object, copy internal memory, overwrite with specific values
+    IIRFILT_MULTI() q_copy = (IIRFILT_MULTI()) malloc(sizeof(struct IIRFILT_MULTI(_s)));
+    memmove(q_copy, q_orig, sizeof(struct IIRFILT_MULTI(_s)));
+
+    // copy coefficients and state
+    q_copy->b = (TC *) liquid_malloc_copy(q_orig->b, 3*q_orig->nsos, sizeof(TC));
+    q_copy->a = (TC *) liquid_malloc_copy(q_orig->a, 3*q_orig->nsos, sizeof(TC));
+    q_copy->v = (TO *) liquid_malloc_copy(q_orig->v, 2*q_orig->nsos*q_orig->num_channels, sizeof(TO));
+    q_copy->t = (TO *) malloc(q_copy->num_channels*sizeof(TO));
+
+    // return object
+    return q_copy;
+}
+
+// destroy object, freeing all internal memory
+int IIRFILT_MULTI(_destroy)(IIRFILT_MULTI() _q)
+{
+    free(_q->b);
+    free(_q->a);
+    free(_q->v);
+    free(_q->t);
+    free(_q);
+    return LIQUID_OK;
+}
+
+// print object internals
+int IIRFILT_MULTI(_print)(IIRFILT_MULTI() _q)
+{
+    printf("<liquid.iirfilt_multi_%s", EXTENSION_FULL);
+    printf(", nsos=%u", _q->nsos);
+    printf(", channels=%u", _q->num_channels);
+    printf(">\n");
+    return LIQUID_OK;
+}
+
+// clear/reset internal state for all channels
+int IIRFILT_MULTI(_reset)(IIRFILT_MULTI() _q)
+{
+    memset(_q->v, 0, 2*(_q->nsos)*(_q->num_channels)*sizeof(TO));
+    return LIQUID_OK;
+}
+
+// clear/reset internal state for a single channel
+int IIRFILT_MULTI(_reset_channel)(IIRFILT_MULTI() _q,
+                                  unsigned int    _channel)
+{
+    if (_channel >= _q->num_channels)
+        return liquid_error(LIQUID_EIRANGE,"iirfilt_multi_%s_reset_channel(), channel index (%u) out of range", EXTENSION_FULL, _channel);
+
+    unsigned int i;
+    for (i=0; i<2*_q->nsos; i++)
+        _q->v[i*_q->num_channels + _channel] = 0;
+    return LIQUID_OK;
+}
+
+// get number of channels
+unsigned int IIRFILT_MULTI(_get_num_channels)(IIRFILT_MULTI() _q)
+{
+    return _q->num_channels;
+}
+
+// set scale value to be applied to each output sample
+int IIRFILT_MULTI(_set_scale)(IIRFILT_MULTI() _q, TC _scale)
+{
+    _q->scale = _scale;
+    return LIQUID_OK;
+}
+
+// get output scaling for filter
+int IIRFILT_MULTI(_get_scale)(IIRFILT_MULTI() _q, TC * _scale)
+{
+    *_scale = _q->scale;
+    return LIQUID_OK;
+}
+
+// execute filter on one sample from each channel
+//  _q      :   filter object
+//  _x      :   input samples, one per channel [size: num_channels x 1]
+//  _y      :   output samples, one per channel [size: num_channels x 1]
+int IIRFILT_MULTI(_execute)(IIRFILT_MULTI() _q,
+                            TI *            _x,
+                            TO *            _y)
+{
+    unsigned int M = _q->num_channels;
+    unsigned int c, s;
+
+    // load input into intermediate buffer (supports in-place operation)
+    TO * t = _q->t;
+    for (c=0; c<M; c++)
+        t[c] = _x[c];
+
+    // run each section across all channels; the inner loops carry no
+    // dependency between channels and map directly onto vector lanes
+    for (s=0; s<_q->nsos; s++) {
+        TC b0 = _q->b[3*s+0], b1 = _q->b[3*s+1], b2 = _q->b[3*s+2];
+        TC a1 = _q->a[3*s+1], a2 = _q->a[3*s+2];
+        TO * v1 = _q->v + (2*s+0)*M;
+        TO * v2 = _q->v + (2*s+1)*M;
+        for (c=0; c<M; c++) {
+            // compute new v[0] and output (direct form II)
+            TO v0 = t[c] - a1*v1[c] - a2*v2[c];
+            t[c]  = b0*v0 + b1*v1[c] + b2*v2[c];
+
+            // advance state
+            v2[c] = v1[c];
+            v1[c] = v0;
+        }
+    }
+
+    // apply scaling
+    for (c=0; c<M; c++)
+        _y[c] = t[c] * _q->scale;
+    return LIQUID_OK;
+}
+
+// execute filter on a block of samples from each channel; in-place
+// operation is permitted
+//  _q      :   filter object
+//  _x      :   input array, sample-major [size: _n x num_channels]
+//  _n      :   number of samples per channel
+//  _y      :   output array, sample-major [size: _n x num_channels]
+int IIRFILT_MULTI(_execute_block)(IIRFILT_MULTI() _q,
+                                  TI *            _x,
+                                  unsigned int    _n,
+                                  TO *            _y)
+{
+    unsigned int i;
+    for (i=0; i<_n; i++)
+        IIRFILT_MULTI(_execute)(_q, &_x[i*_q->num_channels], &_y[i*_q->num_channels]);
+    return LIQUID_OK;
+}
@@ -38,6 +38,9 @@
 // use structured dot product? 0:no, 1:yes
 #define LIQUID_IIRFILTSOS_USE_DOTPROD   (0)
 
+// number of outputs computed per iteration of the look-ahead block method
+#define LIQUID_IIRFILTSOS_BLOCK_LEN     (8)
+
 struct IIRFILTSOS(_s) {
     TC b[3];    // feed-forward coefficients
     TC a[3];    // feed-back coefficients
@@ -47,6 +50,18 @@ struct IIRFILTSOS(_s) {
     TO y[3];    // Direct form I  buffer (output)
     TO v[3];    // Direct form II buffer
 
+    // state-space look-ahead terms for block execution, where the
+    // Direct form II state is s = [v[0], v[1]] before each block:
+    //   y[k]     = yp[k] v[0] + yq[k] v[1] + sum_{j<=k} h[k-j] x[j]
+    //   v[0]'    = wp[L-1] v[0] + wq[L-1] v[1] + sum_{j<L}   g[L-1-j] x[j]
+    //   v[1]'    = wp[L-2] v[0] + wq[L-2] v[1] + sum_{j<L-1} g[L-2-j] x[j]
+    TC h [LIQUID_IIRFILTSOS_BLOCK_LEN]; // impulse response of B(z)/A(z)
+    TC g [LIQUID_IIRFILTSOS_BLOCK_LEN]; // impulse response of 1/A(z)
+    TC yp[LIQUID_IIRFILTSOS_BLOCK_LEN]; // output response to v[0]
+    TC yq[LIQUID_IIRFILTSOS_BLOCK_LEN]; // output response to v[1]
+    TC wp[LIQUID_IIRFILTSOS_BLOCK_LEN]; // state response to v[0]
+    TC wq[LIQUID_IIRFILTSOS_BLOCK_LEN]; // state response to v[1]
+
 #if LIQUID_IIRFILTSOS_USE_DOTPROD
     DOTPROD() dpb;  // numerator dot product
     DOTPROD() dpa;  // denominator dot product
@@ -96,6 +111,28 @@ int IIRFILTSOS(_set_coefficients)(IIRFILTSOS() _q,
     _q->dpa = DOTPROD(_create)(_q->a+1, 2);
     _q->dpb = DOTPROD(_create)(_q->b,   3);
 #endif
+
+    // compute look-ahead terms by running the recursion for the
+    // internal state over one block; the first two elements of each
+    // array hold the initial conditions w[-2], w[-1]
+    unsigned int L = LIQUID_IIRFILTSOS_BLOCK_LEN;
+    unsigned int k;
+    TC g[LIQUID_IIRFILTSOS_BLOCK_LEN+2] = {0, 0};  // impulse input
+    TC p[LIQUID_IIRFILTSOS_BLOCK_LEN+2] = {0, 1};  // w[-1] = 1
+    TC q[LIQUID_IIRFILTSOS_BLOCK_LEN+2] = {1, 0};  // w[-2] = 1
+    for (k=2; k<L+2; k++) {
+        g[k] = (k==2 ? 1 : 0) - _q->a[1]*g[k-1] - _q->a[2]*g[k-2];
+        p[k] =                - _q->a[1]*p[k-1] - _q->a[2]*p[k-2];
+        q[k] =                - _q->a[1]*q[k-1] - _q->a[2]*q[k-2];
+
+        // apply feed-forward section
+        _q->g [k-2] = g[k];
+        _q->h [k-2] = _q->b[0]*g[k] + _q->b[1]*g[k-1] + _q->b[2]*g[k-2];
+        _q->wp[k-2] = p[k];
+        _q->yp[k-2] = _q->b[0]*p[k] + _q->b[1]*p[k-1] + _q->b[2]*p[k-2];
+        _q->wq[k-2] = q[k];
+        _q->yq[k-2] = _q->b[0]*q[k] + _q->b[1]*q[k-1] + _q->b[2]*q[k-2];
+    }
     return LIQUID_OK;
 }
 
@@ -261,6 +298,63 @@ int IIRFILTSOS(_execute_df2)(IIRFILTSOS() _q,
     return LIQUID_OK;
 }
 
+// compute filter output on a block of samples using state-space
+// look-ahead; several outputs are computed per iteration from the
+// state at the start of the block, removing the sample-to-sample
+// recursion from the inner loops. Remaining samples which do not fill
+// a complete block are processed with the direct form II method.
+//  _q      : iirfiltsos object
+//  _x      : input array [size: _n x 1]
+//  _n      : number of samples
+//  _y      : output array [size: _n x 1]
+int IIRFILTSOS(_execute_block)(IIRFILTSOS() _q,
+                               TI *         _x,
+                               unsigned int _n,
+                               TO *         _y)
+{
+    unsigned int L = LIQUID_IIRFILTSOS_BLOCK_LEN;
+    unsigned int i, j, k;
+    TI x[LIQUID_IIRFILTSOS_BLOCK_LEN];  // input block (supports in-place operation)
+    TO y[LIQUID_IIRFILTSOS_BLOCK_LEN];  // output block
+    TO s0 = _q->v[0];   // w[n-1]
+    TO s1 = _q->v[1];   // w[n-2]
+
+    for (i=0; i+L <= _n; i+=L) {
+        for (k=0; k<L; k++)
+            x[k] = _x[i+k];
+
+        // contribution from initial state
+        for (k=0; k<L; k++)
+            y[k] = _q->yp[k]*s0 + _q->yq[k]*s1;
+
+        // contribution from input (lower-triangular Toeplitz product)
+        for (j=0; j<L; j++) {
+            for (k=j; k<L; k++)
+                y[k] += _q->h[k-j]*x[j];
+        }
+
+        // advance state to end of block
+        TO t0 = _q->wp[L-1]*s0 + _q->wq[L-1]*s1;
+        TO t1 = _q->wp[L-2]*s0 + _q->wq[L-2]*s1;
+        for (j=0; j<L; j++)
+            t0 += _q->g[L-1-j]*x[j];
+        for (j=0; j<L-1; j++)
+            t1 += _q->g[L-2-j]*x[j];
+        s0 = t0;
+        s1 = t1;
+
+        for (k=0; k<L; k++)
+            _y[i+k] = y[k];
+    }
+
+    // save state and run remaining samples
+    _q->v[0] = s0;
+    _q->v[1] = s1;
+    for ( ; i<_n; i++)
+        IIRFILTSOS(_execute_df2)(_q, _x[i], &_y[i]);
+    return LIQUID_OK;
+}
+
 // compute group delay in samples
 //  _q      :   filter object
 //  _fc     :   frequency
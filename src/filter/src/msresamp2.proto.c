@@ -373,9 +373,7 @@ int MSRESAMP2(_interp_execute)(MSRESAMP2() _q,
             b1 = _y;
 
         // run half-band stages as interpolators
-        unsigned int i;
-        for (i=0; i<k; i++)
-            RESAMP2(_interp_execute)(_q->resamp2[s], b0[i], &b1[2*i]);
+        RESAMP2(_interp_execute_block)(_q->resamp2[s], b0, k, b1);
 
         // toggle output buffer pointers
         b0 = (s % 2) == 0 ? _q->buffer1 : _q->buffer0;
@@ -403,10 +401,8 @@ int MSRESAMP2(_decim_execute)(MSRESAMP2() _q,
         k = 1 << (_q->num_stages - s - 1);
 
         // run half-band stages as decimators
-        unsigned int i;
         unsigned int g = _q->num_stages-s-1;    // reversed resampler index
-        for (i=0; i<k; i++)
-            RESAMP2(_decim_execute)(_q->resamp2[g], &b0[2*i], &b1[i]);
+        RESAMP2(_decim_execute_block)(_q->resamp2[g], b0, k, b1);
 
         // toggle output buffer pointers
         b0 = (s % 2) == 0 ? _q->buffer1 : _q->buffer0;
@@ -35,13 +35,25 @@
 //  DOTPROD()       dotprod macro
 //  PRINTVAL()      print macro
 
-#define LIQUID_ORDFILT_USE_WINDOW 1
+// use window with full sort for each output? 0:no, 1:yes
+#define LIQUID_ORDFILT_USE_WINDOW 0
 
 #if LIQUID_ORDFILT_USE_WINDOW
 int ordfilt_sort_compf(const void * _v1, const void * _v2)
 {
     return *(float*)_v1 > *(float*)_v2 ? 1 : -1;
 }
+#else
+// forward declaration of internal methods
+
+// swap two entries in the heap array, updating their positions
+void ORDFILT(_heap_swap)(ORDFILT()    _q,
+                         unsigned int _p0,
+                         unsigned int _p1);
+
+// restore heap property for entry at position _p within its heap
+void ORDFILT(_heap_update)(ORDFILT()    _q,
+                           unsigned int _p);
 #endif
 
 // ordfilt object structure
@@ -53,9 +65,13 @@ struct ORDFILT(_s) {
     WINDOW()        buf;        // input buffer
     TI *            buf_sorted; // input buffer (sorted)
 #else
-    // trickier to implement but faster
-    TI *            buf;        // input buffer
-    uint16_t *      buf_index;  // buffer index of sorted values
+    // indexable double heap with O(log n) update per sample
+    TI *            buf;        // circular input buffer [size: n x 1]
+    unsigned int    index;      // buffer index of oldest sample
+    unsigned int *  heap;       // buffer indices arranged as two heaps:
+                                //   heap[0..k]   : max-heap, k+1 smallest values
+                                //   heap[k+1..n) : min-heap, remaining values
+    unsigned int *  pos;        // heap position of each buffer index
 #endif
 };
 
@@ -82,6 +98,10 @@ ORDFILT() ORDFILT(_create)(unsigned int _n,
     q->buf        = WINDOW(_create)(q->n);
     q->buf_sorted = (TI*) malloc(q->n * sizeof(TI));
 #else
+    // allocate buffer and heap arrays
+    q->buf  = (TI*)           malloc(q->n * sizeof(TI));
+    q->heap = (unsigned int*) malloc(q->n * sizeof(unsigned int));
+    q->pos  = (unsigned int*) malloc(q->n * sizeof(unsigned int));
 #endif
 
     // reset filter state (clear buffer)
@@ -113,8 +133,9 @@ ORDFILT() ORDFILT(_copy)(ORDFILT() q_orig)
     q_copy->buf_sorted = (TI*) liquid_malloc_copy(q_orig->buf_sorted, q_orig->n, sizeof(TI));
 #else
     // copy buffers
-    q_copy->buf_      = (TI*)       liquid_malloc_copy(q_orig->buf,       q_orig->n, sizeof(TI));
-    q_copy->buf_index = (uint16_t*) liquid_malloc_copy(q_orig->buf_index, q_orig->n, sizeof(uint16_t));
+    q_copy->buf  = (TI*)           liquid_malloc_copy(q_orig->buf,  q_orig->n, sizeof(TI));
+    q_copy->heap = (unsigned int*) liquid_malloc_copy(q_orig->heap, q_orig->n, sizeof(unsigned int));
+    q_copy->pos  = (unsigned int*) liquid_malloc_copy(q_orig->pos,  q_orig->n, sizeof(unsigned int));
 #endif
 
     return q_copy;
@@ -127,6 +148,9 @@ int ORDFILT(_destroy)(ORDFILT() _q)
     WINDOW(_destroy)(_q->buf);
     free(_q->buf_sorted);
 #else
+    free(_q->buf);
+    free(_q->heap);
+    free(_q->pos);
 #endif
     free(_q);
     return LIQUID_OK;
@@ -138,6 +162,14 @@ int ORDFILT(_reset)(ORDFILT() _q)
 #if LIQUID_ORDFILT_USE_WINDOW
     return WINDOW(_reset)(_q->buf);
 #else
+    // clear buffer; all values are equal so any arrangement is a valid heap
+    unsigned int i;
+    for (i=0; i<_q->n; i++) {
+        _q->buf[i]  = 0;
+        _q->heap[i] = i;
+        _q->pos[i]  = i;
+    }
+    _q->index = 0;
 #endif
     return LIQUID_OK;
 }
@@ -158,6 +190,20 @@ int ORDFILT(_push)(ORDFILT() _q,
 #if LIQUID_ORDFILT_USE_WINDOW
     return WINDOW(_push)(_q->buf, _x);
 #else
+    // replace oldest sample and restore its heap
+    unsigned int i = _q->index;
+    _q->buf[i] = _x;
+    ORDFILT(_heap_update)(_q, _q->pos[i]);
+    _q->index = (i + 1) % _q->n;
+
+    // ensure all values in max-heap are no larger than those in min-heap
+    // by exchanging roots; only the updated value can violate this
+    unsigned int k = _q->k;
+    if (k+1 < _q->n && _q->buf[_q->heap[0]] > _q->buf[_q->heap[k+1]]) {
+        ORDFILT(_heap_swap)(_q, 0, k+1);
+        ORDFILT(_heap_update)(_q, 0);
+        ORDFILT(_heap_update)(_q, k+1);
+    }
 #endif
     return LIQUID_OK;
 }
@@ -173,6 +219,9 @@ int ORDFILT(_write)(ORDFILT()    _q,
 #if LIQUID_ORDFILT_USE_WINDOW
     return WINDOW(_write)(_q->buf, _x, _n);
 #else
+    unsigned int i;
+    for (i=0; i<_n; i++)
+        ORDFILT(_push)(_q, _x[i]);
 #endif
     return LIQUID_OK;
 }
@@ -197,6 +246,8 @@ int ORDFILT(_execute)(ORDFILT() _q,
     // save output
     *_y = _q->buf_sorted[_q->k];
 #else
+    // order statistic is root of max-heap
+    *_y = _q->buf[_q->heap[0]];
 #endif
     return LIQUID_OK;
 }
@@ -235,3 +286,51 @@ int ORDFILT(_execute_block)(ORDFILT()    _q,
     return LIQUID_OK;
 }
 
+
+#if !LIQUID_ORDFILT_USE_WINDOW
+// swap two entries in the heap array, updating their positions
+void ORDFILT(_heap_swap)(ORDFILT()    _q,
+                         unsigned int _p0,
+                         unsigned int _p1)
+{
+    unsigned int t = _q->heap[_p0];
+    _q->heap[_p0] = _q->heap[_p1];
+    _q->heap[_p1] = t;
+    _q->pos[_q->heap[_p0]] = _p0;
+    _q->pos[_q->heap[_p1]] = _p1;
+}
+
+// restore heap property for entry at position _p within its heap; the
+// max-heap occupies positions [0,k] and the min-heap (k,n) such that
+// comparisons are reversed by the sign s
+void ORDFILT(_heap_update)(ORDFILT()    _q,
+                           unsigned int _p)
+{
+    unsigned int base = _p <= _q->k ? 0 : _q->k+1;          // heap offset
+    unsigned int len  = _p <= _q->k ? _q->k+1 : _q->n-_q->k-1;
+    float        s    = _p <= _q->k ? 1.0f : -1.0f;         // max/min heap
+    unsigned int i    = _p - base;                          // index within heap
+
+    // sift up
+    while (i > 0) {
+        unsigned int parent = (i-1)/2;
+        if (s*_q->buf[_q->heap[base+i]] <= s*_q->buf[_q->heap[base+parent]])
+            break;
+        ORDFILT(_heap_swap)(_q, base+i, base+parent);
+        i = parent;
+    }
+
+    // sift down
+    while (1) {
+        unsigned int c = 2*i+1;
+        if (c >= len)
+            break;
+        if (c+1 < len && s*_q->buf[_q->heap[base+c+1]] > s*_q->buf[_q->heap[base+c]])
+            c++;
+        if (s*_q->buf[_q->heap[base+c]] <= s*_q->buf[_q->heap[base+i]])
+            break;
+        ORDFILT(_heap_swap)(_q, base+i, base+c);
+        i = c;
+    }
+}
+#endif
@@ -36,6 +36,9 @@
 //  DOTPROD()       dotprod macro
 //  PRINTVAL()      print macro
 
+// number of output samples processed per iteration in block methods
+#define LIQUID_RESAMP2_BLOCK_LEN (256)
+
 struct RESAMP2(_s) {
     TC *            h;      // filter prototype
     unsigned int    m;      // primitive filter length
@@ -55,6 +58,9 @@ struct RESAMP2(_s) {
 
     // halfband filter operation
     unsigned int    toggle;
+
+    // linearized filter branch for block methods
+    TI *            buf;    // [size: h1_len - 1 + LIQUID_RESAMP2_BLOCK_LEN x 1]
 };
 
 // create a resamp2 object
@@ -110,6 +116,9 @@ RESAMP2() RESAMP2(_create)(unsigned int _m,
     q->w0 = WINDOW(_create)(2*(q->m));
     q->w1 = WINDOW(_create)(2*(q->m));
 
+    // allocate memory for block processing
+    q->buf = (TI *) malloc((q->h1_len - 1 + LIQUID_RESAMP2_BLOCK_LEN)*sizeof(TI));
+
     RESAMP2(_reset)(q);
     RESAMP2(_set_scale)(q, 1);
 
@@ -185,6 +194,9 @@ RESAMP2() RESAMP2(_copy)(RESAMP2() q_orig)
     q_copy->w0 = WINDOW (_copy)(q_orig->w0);
     q_copy->w1 = WINDOW (_copy)(q_orig->w1);
 
+    // allocate block buffer (contents need not be preserved)
+    q_copy->buf = (TI *) malloc((q_copy->h1_len - 1 + LIQUID_RESAMP2_BLOCK_LEN)*sizeof(TI));
+
     // return object
     return q_copy;
 }
@@ -202,6 +214,7 @@ int RESAMP2(_destroy)(RESAMP2() _q)
     // free arrays
     free(_q->h);
     free(_q->h1);
+    free(_q->buf);
 
     // free main object memory
     free(_q);
@@ -399,3 +412,104 @@ int RESAMP2(_interp_execute)(RESAMP2() _q,
     return LIQUID_OK;
 }
 
+
+// execute half-band decimation on a block of samples
+//  _q      :   resamp2 object
+//  _x      :   input array [size: 2*_n x 1]
+//  _n      :   number of output samples
+//  _y      :   output array [size: _n x 1]
+int RESAMP2(_decim_execute_block)(RESAMP2()    _q,
+                                  TI *         _x,
+                                  unsigned int _n,
+                                  TO *         _y)
+{
+    unsigned int p = _q->h1_len - 1;    // filter branch history length
+    unsigned int i;
+    TI * r;     // buffer read pointer
+
+    while (_n > 0) {
+        unsigned int n = _n < LIQUID_RESAMP2_BLOCK_LEN ? _n : LIQUID_RESAMP2_BLOCK_LEN;
+
+        // linearize filter branch: history followed by even input samples
+        WINDOW(_read)(_q->w1, &r);
+        memmove(_q->buf, r+1, p*sizeof(TI));
+        for (i=0; i<n; i++)
+            _q->buf[p+i] = _x[2*i];
+
+        // compute filter branch
+        for (i=0; i<n; i++)
+            DOTPROD(_execute)(_q->dp, &_q->buf[i], &_y[i]);
+
+        // compute delay branch (center tap) by indexing directly into the
+        // history and input arrays, skipping all zero-valued taps
+        WINDOW(_read)(_q->w0, &r);
+        for (i=0; i<n && i<_q->m; i++)
+            _y[i] += r[i + _q->m];
+        for (   ; i<n; i++)
+            _y[i] += _x[2*(i - _q->m) + 1];
+
+        // apply scaling factor
+        for (i=0; i<n; i++)
+            _y[i] *= _q->scale;
+
+        // update window state with most recent samples only
+        unsigned int k = n < _q->h1_len ? n : _q->h1_len;
+        WINDOW(_write)(_q->w1, &_q->buf[p+n-k], k);
+        for (i=n-k; i<n; i++)
+            WINDOW(_push)(_q->w0, _x[2*i+1]);
+
+        // update pointers, counters
+        _x += 2*n;
+        _y += n;
+        _n -= n;
+    }
+    return LIQUID_OK;
+}
+
+// execute half-band interpolation on a block of samples
+//  _q      :   resamp2 object
+//  _x      :   input array [size: _n x 1]
+//  _n      :   number of input samples
+//  _y      :   output array [size: 2*_n x 1]
+int RESAMP2(_interp_execute_block)(RESAMP2()    _q,
+                                   TI *         _x,
+                                   unsigned int _n,
+                                   TO *         _y)
+{
+    unsigned int p = _q->h1_len - 1;    // filter branch history length
+    unsigned int i;
+    TI * r;     // buffer read pointer
+
+    while (_n > 0) {
+        unsigned int n = _n < LIQUID_RESAMP2_BLOCK_LEN ? _n : LIQUID_RESAMP2_BLOCK_LEN;
+
+        // compute delay branch (center tap) from history and input arrays
+        WINDOW(_read)(_q->w0, &r);
+        for (i=0; i<n && i<_q->m; i++)
+            _y[2*i] = r[i + _q->m] * _q->scale;
+        for (   ; i<n; i++)
+            _y[2*i] = _x[i - _q->m] * _q->scale;
+
+        // linearize filter branch: history followed by input samples
+        WINDOW(_read)(_q->w1, &r);
+        memmove(_q->buf, r+1, p*sizeof(TI));
+        memmove(_q->buf+p, _x, n*sizeof(TI));
+
+        // compute filter branch
+        for (i=0; i<n; i++) {
+            DOTPROD(_execute)(_q->dp, &_q->buf[i], &_y[2*i+1]);
+            _y[2*i+1] *= _q->scale;
+        }
+
+        // update window state with most recent samples only
+        unsigned int k = n < _q->h1_len ? n : _q->h1_len;
+        WINDOW(_write)(_q->w0, &_x[n-k], k);
+        WINDOW(_write)(_q->w1, &_x[n-k], k);
+
+        // update pointers, counters
+        _x += n;
+        _y += 2*n;
+        _n -= n;
+    }
+    return LIQUID_OK;
+}
@@ -43,16 +43,6 @@
 // forward declaration of internal methods
 //
 
-// step synchronizer
-//  _q      : symsync object
-//  _x      : input sample
-//  _y      : output sample array pointer
-//  _ny     : number of output samples written
-int SYMSYNC(_step)(SYMSYNC()      _q,
-                   TI             _x,
-                   TO *           _y,
-                   unsigned int * _ny);
-
 // advance synchronizer's internal loop filter
 //  _q      : synchronizer object
 //  _mf     : matched-filter output
@@ -88,9 +78,13 @@ struct SYMSYNC(_s)
     iirfiltsos_rrrf pll;        // loop filter object (iir filter)
     float rate_adjustment;      // internal rate adjustment factor
 
+    // matched and derivative-matched filterbanks share a single input
+    // window; their dot product objects are interleaved so that filter
+    // b of the matched filter is dp[2b] and its derivative is dp[2b+1]
     unsigned int npfb;          // number of filters in the bank
-    FIRPFB()      mf;           // matched filter
-    FIRPFB()     dmf;           // derivative matched filter
+    unsigned int h_sub_len;     // length of each sub-filter
+    WINDOW()     w;             // input sample window
+    DOTPROD() *  dp;            // interleaved MF/dMF dot products [2*npfb]
 };
 
 // create synchronizer object from external coefficients
@@ -148,8 +142,22 @@ SYMSYNC() SYMSYNC(_create)(unsigned int _k,
     for (i=0; i<_h_len; i++)
         dh[i] *= 0.06f / hdh_max;
 
-    q->mf  = FIRPFB(_create)(q->npfb, _h, _h_len);
-    q->dmf = FIRPFB(_create)(q->npfb, dh, _h_len);
+    // generate interleaved bank of sub-sampled filters, each stored in
+    // reverse order for the dot product
+    q->h_sub_len = _h_len / q->npfb;
+    q->dp = (DOTPROD()*) malloc(2*q->npfb*sizeof(DOTPROD()));
+    TC  h_sub[q->h_sub_len];
+    TC dh_sub[q->h_sub_len];
+    unsigned int n;
+    for (i=0; i<q->npfb; i++) {
+        for (n=0; n<q->h_sub_len; n++) {
+             h_sub[q->h_sub_len-n-1] = _h[i + n*q->npfb];
+            dh_sub[q->h_sub_len-n-1] =  dh[i + n*q->npfb];
+        }
+        q->dp[2*i+0] = DOTPROD(_create)( h_sub, q->h_sub_len);
+        q->dp[2*i+1] = DOTPROD(_create)(dh_sub, q->h_sub_len);
+    }
+    q->w = WINDOW(_create)(q->h_sub_len);
 
     // reset state and initialize loop filter
     q->A[0] = 1.0f;     q->B[0] = 0.0f;
@@ -262,9 +270,12 @@ SYMSYNC() SYMSYNC(_copy)(SYMSYNC() q_orig)
     // copy phased-locked loop
     q_copy->pll = iirfiltsos_rrrf_copy(q_orig->pll);
 
-    // copy filter banks
-    q_copy->mf  = FIRPFB(_copy)(q_orig->mf);
-    q_copy->dmf = FIRPFB(_copy)(q_orig->dmf);
+    // copy input window and filter banks (coefficients are shared)
+    q_copy->w  = WINDOW(_copy)(q_orig->w);
+    q_copy->dp = (DOTPROD()*) malloc(2*q_orig->npfb*sizeof(DOTPROD()));
+    unsigned int i;
+    for (i=0; i<2*q_orig->npfb; i++)
+        q_copy->dp[i] = DOTPROD(_copy)(q_orig->dp[i]);
 
     // return object
     return q_copy;
@@ -273,9 +284,12 @@ SYMSYNC() SYMSYNC(_copy)(SYMSYNC() q_orig)
 // destroy symsync object, freeing all internal memory
 int SYMSYNC(_destroy)(SYMSYNC() _q)
 {
-    // destroy filterbank objects
-    FIRPFB(_destroy)(_q->mf);
-    FIRPFB(_destroy)(_q->dmf);
+    // destroy input window and filterbank objects
+    WINDOW(_destroy)(_q->w);
+    unsigned int i;
+    for (i=0; i<2*_q->npfb; i++)
+        DOTPROD(_destroy)(_q->dp[i]);
+    free(_q->dp);
 
     // destroy timing phase-locked loop filter
     iirfiltsos_rrrf_destroy(_q->pll);
@@ -288,16 +302,16 @@ int SYMSYNC(_destroy)(SYMSYNC() _q)
 // print symsync object's parameters
 int SYMSYNC(_print)(SYMSYNC() _q)
 {
-    printf("<liquid.symsync_%s, rate=%g, k_in=%u, k_out=%u>\n",
-        EXTENSION_FULL, _q->rate, _q->k, _q->k_out);
-    return FIRPFB(_print)(_q->mf);
+    printf("<liquid.symsync_%s, rate=%g, k_in=%u, k_out=%u, npfb=%u, h_sub_len=%u>\n",
+        EXTENSION_FULL, _q->rate, _q->k, _q->k_out, _q->npfb, _q->h_sub_len);
+    return LIQUID_OK;
 }
 
 // reset symsync internal state
 int SYMSYNC(_reset)(SYMSYNC() _q)
 {
-    // reset polyphase filterbank
-    FIRPFB(_reset)(_q->mf);
+    // clear input window shared by both filterbanks
+    WINDOW(_reset)(_q->w);
 
     // reset counters, etc.
     _q->rate          = (float)_q->k / (float)_q->k_out;
@@ -432,86 +446,64 @@ int SYMSYNC(_execute)(SYMSYNC()      _q,
                       TO *           _y,
                       unsigned int * _ny)
 {
-    unsigned int i, ny=0, k=0;
+    TI * r;         // read pointer
+    TO   mf;        // matched filter output
+    TO  dmf;        // derivative matched filter output
+    unsigned int i, n=0;
     for (i=0; i<_nx; i++) {
-        SYMSYNC(_step)(_q, _x[i], &_y[ny], &k);
-        ny += k;
-        //printf("%u\n",k);
-    }
-    *_ny = ny;
-    return LIQUID_OK;
-}
-
-//
-// internal methods
-//
-
-// step synchronizer with single input sample
-//  _q      : symsync object
-//  _x      : input sample
-//  _y      : output sample array pointer
-//  _ny     : number of output samples written
-int SYMSYNC(_step)(SYMSYNC()      _q,
-                   TI             _x,
-                   TO *           _y,
-                   unsigned int * _ny)
-{
-    // push sample into MF and dMF filterbanks
-    FIRPFB(_push)(_q->mf,  _x);
-    FIRPFB(_push)(_q->dmf, _x);
-
-    // matched and derivative matched-filter outputs
-    TO  mf; // matched filter output
-    TO dmf; // derivative matched filter output
-
-    unsigned int n=0;
-
-    // continue loop until filterbank index rolls over
-    while (_q->b < (int)_q->npfb) {
-
-        // compute filterbank output
-        FIRPFB(_execute)(_q->mf, _q->b, &mf);
-
-        // scale output by samples/symbol
-        _y[n] = mf / (float)(_q->k);
-
-        // check output count and determine if this is 'ideal' timing output
-        if (_q->decim_counter == _q->k_out) {
-            // reset counter
-            _q->decim_counter = 0;
-
-            // if synchronizer is locked, don't update internal timing offset
-            if (_q->is_locked)
-                continue;
-
-            // compute dMF output
-            FIRPFB(_execute)(_q->dmf, _q->b, &dmf);
-
-            // update internal state
-            SYMSYNC(_advance_internal_loop)(_q, mf, dmf);
-            _q->tau_decim = _q->tau;    // save return value
+        // push sample into window shared by MF and dMF filterbanks
+        WINDOW(_push)(_q->w, _x[i]);
+        WINDOW(_read)(_q->w, &r);
+
+        // continue loop until filterbank index rolls over
+        while (_q->b < (int)_q->npfb) {
+
+            // compute matched filter output, scaled by samples/symbol
+            DOTPROD(_execute)(_q->dp[2*_q->b], r, &mf);
+            _y[n] = mf / (float)(_q->k);
+
+            // check output count and determine if this is 'ideal' timing output
+            if (_q->decim_counter == _q->k_out) {
+                // reset counter
+                _q->decim_counter = 0;
+
+                // if synchronizer is locked, don't update internal timing offset
+                if (_q->is_locked)
+                    continue;
+
+                // compute dMF output on the same input window
+                DOTPROD(_execute)(_q->dp[2*_q->b+1], r, &dmf);
+
+                // update internal state
+                SYMSYNC(_advance_internal_loop)(_q, mf, dmf);
+                _q->tau_decim = _q->tau;    // save return value
+            }
+
+            // increment decimation counter
+            _q->decim_counter++;
+
+            // update states
+            _q->tau += _q->del;                     // instantaneous fractional offset
+            _q->bf  = _q->tau * (float)(_q->npfb);  // filterbank index (soft)
+            _q->b   = (int)roundf(_q->bf);          // filterbank index
+            n++;                                    // number of output samples
         }
 
-        // increment decimation counter
-        _q->decim_counter++;
-
-        // update states
-        _q->tau += _q->del;                     // instantaneous fractional offset
-        _q->bf  = _q->tau * (float)(_q->npfb);  // filterbank index (soft)
-        _q->b   = (int)roundf(_q->bf);          // filterbank index
-        n++;                                    // number of output samples
+        // filterbank index rolled over; update states
+        _q->tau -= 1.0f;                // instantaneous fractional offset
+        _q->bf  -= (float)(_q->npfb);   // filterbank index (soft)
+        _q->b   -= _q->npfb;            // filterbank index
     }
 
-    // filterbank index rolled over; update states
-    _q->tau -= 1.0f;                // instantaneous fractional offset
-    _q->bf  -= (float)(_q->npfb);   // filterbank index (soft)
-    _q->b   -= _q->npfb;            // filterbank index
-
     // set output number of samples written
     *_ny = n;
     return LIQUID_OK;
 }
 
+//
+// internal methods
+//
+
 // advance synchronizer's internal loop filter
 //  _q      : synchronizer object
 //  _mf     : matched-filter output
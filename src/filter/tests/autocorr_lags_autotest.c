@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2007 - 2025 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "autotest/autotest.h"
+#include "liquid.h"
+
+// direct computation of windowed auto-correlation at end of _x
+static void autocorr_lags_direct(float complex * _x,
+                                 unsigned int    _n,
+                                 unsigned int    _window_size,
+                                 unsigned int    _max_lag,
+                                 float complex * _rxx)
+{
+    unsigned int d, k;
+    for (d=0; d<=_max_lag; d++) {
+        _rxx[d] = 0.0f;
+        for (k=0; k<_window_size; k++) {
+            int i0 = (int)_n - 1 - (int)k;
+            int i1 = i0 - (int)d;
+            if (i0 >= 0 && i1 >= 0)
+                _rxx[d] += _x[i0] * conjf(_x[i1]);
+        }
+    }
+}
+
+// compare incremental, FFT-based, and direct computations
+void testbench_autocorr_lags_cccf(unsigned int _window_size,
+                                  unsigned int _max_lag)
+{
+    float tol = 2e-3f * _window_size;
+    unsigned int n = 3*(_window_size + _max_lag) + 17;
+    unsigned int i, d;
+    float complex x[n];
+    for (i=0; i<n; i++)
+        x[i] = cexpf(_Complex_I*(0.3f*i + 0.001f*i*i)) * (1.0f + 0.5f*cosf(0.07f*i));
+
+    autocorr_lags_cccf q0 = autocorr_lags_cccf_create(_window_size, _max_lag);
+    autocorr_lags_cccf q1 = autocorr_lags_cccf_create(_window_size, _max_lag);
+    CONTEND_EQUALITY(autocorr_lags_cccf_get_window_size(q0), _window_size)
+    CONTEND_EQUALITY(autocorr_lags_cccf_get_max_lag    (q0), _max_lag)
+    float complex r0[_max_lag+1], r1[_max_lag+1], r_ref[_max_lag+1];
+
+    // push sample by sample (incremental updates) checking periodically
+    for (i=0; i<n; i++) {
+        autocorr_lags_cccf_push(q0, x[i]);
+        if ((i % 13) == 0 || i == n-1) {
+            autocorr_lags_cccf_execute(q0, r0);
+            autocorr_lags_direct(x, i+1, _window_size, _max_lag, r_ref);
+            for (d=0; d<=_max_lag; d++) {
+                CONTEND_DELTA(crealf(r0[d]), crealf(r_ref[d]), tol);
+                CONTEND_DELTA(cimagf(r0[d]), cimagf(r_ref[d]), tol);
+            }
+        }
+    }
+
+    // write as single block (FFT-based computation)
+    autocorr_lags_cccf_execute_block(q1, x, n, r1);
+    for (d=0; d<=_max_lag; d++) {
+        CONTEND_DELTA(crealf(r1[d]), crealf(r_ref[d]), tol);
+        CONTEND_DELTA(cimagf(r1[d]), cimagf(r_ref[d]), tol);
+    }
+    CONTEND_DELTA(autocorr_lags_cccf_get_energy(q1), crealf(r_ref[0]), tol);
+
+    autocorr_lags_cccf_destroy(q0);
+    autocorr_lags_cccf_destroy(q1);
+}
+
+void autotest_autocorr_lags_cccf_w16_l0()   { testbench_autocorr_lags_cccf( 16,  0); }
+void autotest_autocorr_lags_cccf_w16_l4()   { testbench_autocorr_lags_cccf( 16,  4); }
+void autotest_autocorr_lags_cccf_w64_l63()  { testbench_autocorr_lags_cccf( 64, 63); }
+void autotest_autocorr_lags_cccf_w100_l80() { testbench_autocorr_lags_cccf(100, 80); }
+
+// real-valued version should match lag-specific autocorr object
+void autotest_autocorr_lags_rrrf()
+{
+    unsigned int window_size = 24, max_lag = 10, n = 200, i, d;
+    autocorr_lags_rrrf q = autocorr_lags_rrrf_create(window_size, max_lag);
+    autocorr_rrrf a[max_lag+1];
+    for (d=0; d<=max_lag; d++)
+        a[d] = autocorr_rrrf_create(window_size, d);
+
+    float x, rxx[max_lag+1], v;
+    for (i=0; i<n; i++) {
+        x = cosf(0.21f*i) + 0.3f*sinf(0.013f*i*i);
+        autocorr_lags_rrrf_push(q, x);
+        for (d=0; d<=max_lag; d++)
+            autocorr_rrrf_push(a[d], x);
+    }
+    autocorr_lags_rrrf_execute(q, rxx);
+    for (d=0; d<=max_lag; d++) {
+        autocorr_rrrf_execute(a[d], &v);
+        CONTEND_DELTA(rxx[d], v, 1e-3f);
+        autocorr_rrrf_destroy(a[d]);
+    }
+    autocorr_lags_rrrf_destroy(q);
+}
+
+// copied object should produce the same outputs
+void autotest_autocorr_lags_copy()
+{
+    unsigned int i;
+    autocorr_lags_cccf q0 = autocorr_lags_cccf_create(32, 12);
+    for (i=0; i<50; i++)
+        autocorr_lags_cccf_push(q0, cexpf(_Complex_I*0.4f*i));
+    autocorr_lags_cccf q1 = autocorr_lags_cccf_copy(q0);
+
+    float complex r0[13], r1[13];
+    for (i=50; i<90; i++) {
+        float complex x = cexpf(_Complex_I*0.4f*i);
+        autocorr_lags_cccf_push(q0, x);
+        autocorr_lags_cccf_push(q1, x);
+    }
+    autocorr_lags_cccf_execute(q0, r0);
+    autocorr_lags_cccf_execute(q1, r1);
+    CONTEND_SAME_DATA(r0, r1, sizeof(r0));
+
+    autocorr_lags_cccf_destroy(q0);
+    autocorr_lags_cccf_destroy(q1);
+}
+
+void autotest_autocorr_lags_config()
+{
+#if LIQUID_STRICT_EXIT
+    AUTOTEST_WARN("skipping autocorr_lags config test with strict exit enabled\n");
+    return;
+#endif
+#if !LIQUID_SUPPRESS_ERROR_OUTPUT
+    fprintf(stderr,"warning: ignore potential errors here; checking for invalid configurations\n");
+#endif
+    CONTEND_ISNULL(autocorr_lags_cccf_create(0, 4))
+    CONTEND_ISNULL(autocorr_lags_cccf_copy(NULL))
+
+    autocorr_lags_cccf q = autocorr_lags_cccf_create(16, 4);
+    CONTEND_EQUALITY(LIQUID_OK, autocorr_lags_cccf_print(q))
+    autocorr_lags_cccf_destroy(q);
+}
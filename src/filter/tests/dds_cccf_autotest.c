@@ -187,3 +187,56 @@ void autotest_dds_copy()
     symstreamrcf_destroy(gen);
 }
 
+
+// block methods should match sample-by-sample execution
+void testbench_dds_cccf_block(unsigned int _num_stages)
+{
+    unsigned int r = 1<<_num_stages;    // resampling rate
+    unsigned int n = 317;               // number of low-rate samples
+    unsigned int i;
+    float tol = 1e-5f;
+
+    dds_cccf q0 = dds_cccf_create(_num_stages, 0.1234f, 0.4321f, 60.0f);
+    dds_cccf q1 = dds_cccf_create(_num_stages, 0.1234f, 0.4321f, 60.0f);
+    dds_cccf_set_scale(q0, 0.72280f);
+    dds_cccf_set_scale(q1, 0.72280f);
+
+    // generate high-rate input
+    float complex * x  = (float complex*) malloc(n*r*sizeof(float complex));
+    float complex * y0 = (float complex*) malloc(n*r*sizeof(float complex));
+    float complex * y1 = (float complex*) malloc(n*r*sizeof(float complex));
+    for (i=0; i<n*r; i++)
+        x[i] = cexpf(_Complex_I*(0.02f*i + 0.3f*cosf(0.0071f*i)));
+
+    // decimator
+    for (i=0; i<n; i++)
+        dds_cccf_decim_execute(q0, x + i*r, y0 + i);
+    dds_cccf_decim_execute_block(q1, x, 100, y1);
+    dds_cccf_decim_execute_block(q1, x + 100*r, n-100, y1 + 100);
+    for (i=0; i<n; i++) {
+        CONTEND_DELTA(crealf(y0[i]), crealf(y1[i]), tol);
+        CONTEND_DELTA(cimagf(y0[i]), cimagf(y1[i]), tol);
+    }
+
+    // interpolator
+    dds_cccf_reset(q0);
+    dds_cccf_reset(q1);
+    for (i=0; i<n; i++)
+        dds_cccf_interp_execute(q0, x[i], y0 + i*r);
+    dds_cccf_interp_execute_block(q1, x, 100, y1);
+    dds_cccf_interp_execute_block(q1, x + 100, n-100, y1 + 100*r);
+    for (i=0; i<n*r; i++) {
+        CONTEND_DELTA(crealf(y0[i]), crealf(y1[i]), tol);
+        CONTEND_DELTA(cimagf(y0[i]), cimagf(y1[i]), tol);
+    }
+
+    free(x);
+    free(y0);
+    free(y1);
+    dds_cccf_destroy(q0);
+    dds_cccf_destroy(q1);
+}
+
+void autotest_dds_cccf_block_s1() { testbench_dds_cccf_block(1); }
+void autotest_dds_cccf_block_s3() { testbench_dds_cccf_block(3); }
+void autotest_dds_cccf_block_s6() { testbench_dds_cccf_block(6); }
@@ -154,3 +154,43 @@ void autotest_fdelay_rrrf_push_write()
     fdelay_rrrf_destroy(q1);
 }
 
+
+// compare per-sample delay block execution against setting delay per sample
+void autotest_fdelay_rrrf_execute_block_delay()
+{
+    // create two identical objects
+    fdelay_rrrf q0 = fdelay_rrrf_create_default(40);
+    fdelay_rrrf q1 = fdelay_rrrf_create_default(40);
+
+    // generate pseudo-random inputs and slowly-varying delay
+    unsigned int i, n = 240;
+    float x[n], delay[n], y0[n], y1[n];
+    for (i=0; i<n; i++) {
+        x[i]     = (float)((i*17 + 5) % 11) - 5.0f;
+        delay[i] = 20.0f + 15.0f*sinf(0.03f*(float)i);
+    }
+
+    // run sample by sample
+    for (i=0; i<n; i++) {
+        fdelay_rrrf_set_delay(q0, delay[i]);
+        fdelay_rrrf_push     (q0, x[i]);
+        fdelay_rrrf_execute  (q0, y0+i);
+    }
+
+    // run as block
+    CONTEND_EQUALITY(LIQUID_OK, fdelay_rrrf_execute_block_delay(q1, x, delay, n, y1))
+    CONTEND_SAME_DATA(y0, y1, n*sizeof(float));
+    CONTEND_EQUALITY(fdelay_rrrf_get_delay(q1), delay[n-1])
+
+    // constant delay matches regular block execution
+    for (i=0; i<n; i++)
+        delay[i] = 7.2280f;
+    fdelay_rrrf_set_delay(q0, 7.2280f);
+    fdelay_rrrf_execute_block      (q0, x, n, y0);
+    fdelay_rrrf_execute_block_delay(q1, x, delay, n, y1);
+    CONTEND_SAME_DATA(y0, y1, n*sizeof(float));
+
+    // destroy objects
+    fdelay_rrrf_destroy(q0);
+    fdelay_rrrf_destroy(q1);
+}
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2007 - 2025 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+// test memoized filter design cache
+
+#include "autotest/autotest.h"
+#include "liquid.h"
+
+// designs returned from the cache must match those computed directly
+void autotest_firdes_cache_prototype()
+{
+    unsigned int k=4, m=9, h_len=2*k*m+1;
+    float beta = 0.25f;
+    float h0[h_len], h1[h_len], h2[h_len];
+
+    // design without cache
+    liquid_firdes_cache_clear();
+    CONTEND_EQUALITY(liquid_firdes_cache_is_enabled(), 0);
+    liquid_firdes_prototype(LIQUID_FIRFILT_RKAISER, k, m, beta, 0.0f, h0);
+    CONTEND_EQUALITY(liquid_firdes_cache_get_num_entries(), 0);
+
+    // enable cache; first design is stored and second is retrieved
+    liquid_firdes_cache_enable();
+    liquid_firdes_prototype(LIQUID_FIRFILT_RKAISER, k, m, beta, 0.0f, h1);
+    CONTEND_EQUALITY(liquid_firdes_cache_get_num_entries(), 1);
+    liquid_firdes_prototype(LIQUID_FIRFILT_RKAISER, k, m, beta, 0.0f, h2);
+    CONTEND_EQUALITY(liquid_firdes_cache_get_num_entries(), 1);
+    CONTEND_SAME_DATA(h0, h1, h_len*sizeof(float));
+    CONTEND_SAME_DATA(h0, h2, h_len*sizeof(float));
+
+    // any change in parameters results in a new design
+    liquid_firdes_prototype(LIQUID_FIRFILT_RKAISER, k, m, beta, 0.1f, h1);
+    liquid_firdes_prototype(LIQUID_FIRFILT_ARKAISER,k, m, beta, 0.0f, h1);
+    liquid_firdes_prototype(LIQUID_FIRFILT_RKAISER, k, m, 0.3f, 0.0f, h1);
+    CONTEND_EQUALITY(liquid_firdes_cache_get_num_entries(), 4);
+
+    // Parks-McClellan design is stored once (within firdespm_run)
+    liquid_firdes_prototype(LIQUID_FIRFILT_PM, k, m, beta, 0.0f, h1);
+    CONTEND_EQUALITY(liquid_firdes_cache_get_num_entries(), 5);
+    liquid_firdes_prototype(LIQUID_FIRFILT_PM, k, m, beta, 0.0f, h2);
+    CONTEND_EQUALITY(liquid_firdes_cache_get_num_entries(), 5);
+    CONTEND_SAME_DATA(h1, h2, h_len*sizeof(float));
+
+    // clean up
+    liquid_firdes_cache_disable();
+    liquid_firdes_cache_clear();
+}
+
+// objects created with the cache enabled must behave identically
+void autotest_firdes_cache_firdespm()
+{
+    unsigned int n = 57;
+    float h0[n], h1[n];
+
+    // design without cache
+    liquid_firdes_cache_clear();
+    firdespm_lowpass(n, 0.2f, 60.0f, 0.0f, h0);
+
+    // design twice with cache enabled
+    liquid_firdes_cache_enable();
+    firdespm_lowpass(n, 0.2f, 60.0f, 0.0f, h1);
+    CONTEND_SAME_DATA(h0, h1, n*sizeof(float));
+    firdespm_lowpass(n, 0.2f, 60.0f, 0.0f, h1);
+    CONTEND_SAME_DATA(h0, h1, n*sizeof(float));
+    CONTEND_EQUALITY(liquid_firdes_cache_get_num_entries(), 1);
+
+    // different lengths are keyed separately
+    float h2[n+1];
+    firdespm_lowpass(n+1, 0.2f, 60.0f, 0.0f, h2);
+    CONTEND_EQUALITY(liquid_firdes_cache_get_num_entries(), 2);
+
+    // clean up
+    liquid_firdes_cache_disable();
+    liquid_firdes_cache_clear();
+}
+
+// cache contents survive a save/load cycle
+void autotest_firdes_cache_save_load()
+{
+    const char filename[] = "autotest/logs/firdes_cache.bin";
+    unsigned int k=2, m=7, h_len=2*k*m+1;
+    float h0[h_len], h1[h_len], h2[31];
+
+    // populate cache and save to file
+    liquid_firdes_cache_clear();
+    liquid_firdes_cache_enable();
+    liquid_firdes_prototype(LIQUID_FIRFILT_ARKAISER, k, m, 0.35f, 0.0f, h0);
+    firdespm_lowpass(31, 0.1f, 50.0f, 0.0f, h2);
+    CONTEND_EQUALITY(liquid_firdes_cache_get_num_entries(), 2);
+    CONTEND_EQUALITY(liquid_firdes_cache_save(filename), LIQUID_OK);
+
+    // clear and re-load
+    liquid_firdes_cache_clear();
+    CONTEND_EQUALITY(liquid_firdes_cache_get_num_entries(), 0);
+    CONTEND_EQUALITY(liquid_firdes_cache_load(filename), LIQUID_OK);
+    CONTEND_EQUALITY(liquid_firdes_cache_get_num_entries(), 2);
+
+    // loaded design matches original and does not add an entry
+    liquid_firdes_prototype(LIQUID_FIRFILT_ARKAISER, k, m, 0.35f, 0.0f, h1);
+    CONTEND_SAME_DATA(h0, h1, h_len*sizeof(float));
+    CONTEND_EQUALITY(liquid_firdes_cache_get_num_entries(), 2);
+
+    // loading the same file again does not duplicate entries
+    CONTEND_EQUALITY(liquid_firdes_cache_load(filename), LIQUID_OK);
+    CONTEND_EQUALITY(liquid_firdes_cache_get_num_entries(), 2);
+
+    // clean up
+    liquid_firdes_cache_disable();
+    liquid_firdes_cache_clear();
+}
+
+void autotest_firdes_cache_config()
+{
+#if LIQUID_STRICT_EXIT
+    AUTOTEST_WARN("skipping firdes_cache config test with strict exit enabled\n");
+    return;
+#endif
+#if !LIQUID_SUPPRESS_ERROR_OUTPUT
+    fprintf(stderr,"warning: ignore potential errors here; checking for invalid configurations\n");
+#endif
+    // missing file
+    CONTEND_INEQUALITY(LIQUID_OK, liquid_firdes_cache_load("autotest/logs/firdes_cache_missing.bin"))
+
+    // file which is not a cache
+    const char filename[] = "autotest/logs/firdes_cache_invalid.bin";
+    FILE * fid = fopen(filename, "wb");
+    fprintf(fid, "not a filter design cache\n");
+    fclose(fid);
+    CONTEND_INEQUALITY(LIQUID_OK, liquid_firdes_cache_load(filename))
+    CONTEND_EQUALITY(liquid_firdes_cache_get_num_entries(), 0);
+}
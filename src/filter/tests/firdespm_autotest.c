@@ -264,6 +264,36 @@ void autotest_firdespm_copy()
     firdespm_destroy(q1);
 }
 
+// reduced and automatic grid densities should still meet the specification
+void autotest_firdespm_grid_density()
+{
+    float bands[4] = {0.0, 0.2, 0.3, 0.5};  // regions
+    float   des[2] = {1.0,      0.0};       // desired values
+    float     w[2] = {1.0,      1.0};       // weights
+    liquid_firdespm_wtype wtype[2] = {LIQUID_FIRDESPM_FLATWEIGHT, LIQUID_FIRDESPM_FLATWEIGHT};
+    firdespm q = firdespm_create(51, 2, bands, des, w, wtype, LIQUID_FIRDESPM_BANDPASS);
+    CONTEND_EQUALITY(firdespm_get_grid_density(q), 20)
+
+    // design with default density
+    float h0[51], h1[51];
+    firdespm_execute(q, h0);
+
+    // automatic density is unchanged for a short filter
+    CONTEND_EQUALITY(firdespm_set_grid_density(q, 0), LIQUID_OK)
+    CONTEND_EQUALITY(firdespm_get_grid_density(q), 20)
+    firdespm_execute(q, h1);
+    CONTEND_SAME_DATA(h0, h1, 51*sizeof(float));
+
+    // reduced density gives nearly the same design
+    CONTEND_EQUALITY(firdespm_set_grid_density(q, 8), LIQUID_OK)
+    CONTEND_EQUALITY(firdespm_get_grid_density(q), 8)
+    firdespm_execute(q, h1);
+    unsigned int i;
+    for (i=0; i<51; i++)
+        CONTEND_DELTA(h1[i], h0[i], 2e-3f);
+    firdespm_destroy(q);
+}
+
 void autotest_firdespm_config()
 {
 #if LIQUID_STRICT_EXIT
@@ -294,6 +324,8 @@ void autotest_firdespm_config()
     liquid_firdespm_wtype wtype[2] = {LIQUID_FIRDESPM_FLATWEIGHT, LIQUID_FIRDESPM_FLATWEIGHT};
     firdespm q = firdespm_create(51, 2, bands, des, w, wtype, LIQUID_FIRDESPM_BANDPASS);
     CONTEND_EQUALITY(   LIQUID_OK, firdespm_print(q) )
+    CONTEND_INEQUALITY( LIQUID_OK, firdespm_set_grid_density(q, 1) )
+    CONTEND_INEQUALITY( LIQUID_OK, firdespm_set_grid_density(q, 7) )
     firdespm_destroy(q);
 
     // invalid bands & weights
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2007 - 2025 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "autotest/autotest.h"
+#include "liquid.h"
+
+// set_delay should give the same output as the per-sample delay block
+// method (Farrow structure) with a constant delay
+void autotest_firfarrow_rrrf_execute_block_delay()
+{
+    firfarrow_rrrf q0 = firfarrow_rrrf_create(19, 4, 0.45f, 60.0f);
+    firfarrow_rrrf q1 = firfarrow_rrrf_create(19, 4, 0.45f, 60.0f);
+
+    unsigned int i, n = 80;
+    float x[n], mu[n], y0[n], y1[n];
+    for (i=0; i<n; i++) {
+        x[i]  = (float)((i*17 + 5) % 11) - 5.0f;
+        mu[i] = 0.3f;
+    }
+
+    firfarrow_rrrf_set_delay(q0, 0.3f);
+    firfarrow_rrrf_execute_block(q0, x, n, y0);
+    CONTEND_EQUALITY(LIQUID_OK, firfarrow_rrrf_execute_block_delay(q1, x, mu, n, y1))
+    for (i=0; i<n; i++)
+        CONTEND_DELTA(y0[i], y1[i], 1e-4f);
+
+    firfarrow_rrrf_destroy(q0);
+    firfarrow_rrrf_destroy(q1);
+}
+
+// time-varying delay should match setting the delay before each sample
+void autotest_firfarrow_crcf_execute_block_delay()
+{
+    firfarrow_crcf q0 = firfarrow_crcf_create(19, 4, 0.45f, 60.0f);
+    firfarrow_crcf q1 = firfarrow_crcf_create(19, 4, 0.45f, 60.0f);
+
+    unsigned int i, n = 80;
+    float complex x[n], y0[n], y1[n];
+    float mu[n];
+    for (i=0; i<n; i++) {
+        x[i]  = cexpf(_Complex_I*0.1f*(float)(i*i % 37));
+        mu[i] = 0.9f*sinf(0.11f*(float)i);
+    }
+
+    for (i=0; i<n; i++) {
+        firfarrow_crcf_set_delay(q0, mu[i]);
+        firfarrow_crcf_push     (q0, x[i]);
+        firfarrow_crcf_execute  (q0, y0+i);
+    }
+    firfarrow_crcf_execute_block_delay(q1, x, mu, n, y1);
+    for (i=0; i<n; i++) {
+        CONTEND_DELTA(crealf(y0[i]), crealf(y1[i]), 1e-4f);
+        CONTEND_DELTA(cimagf(y0[i]), cimagf(y1[i]), 1e-4f);
+    }
+
+    firfarrow_crcf_destroy(q0);
+    firfarrow_crcf_destroy(q1);
+}
+
+// invalid delays are rejected
+void autotest_firfarrow_config()
+{
+#if LIQUID_STRICT_EXIT
+    AUTOTEST_WARN("skipping firfarrow config test with strict exit enabled\n");
+    return;
+#endif
+#if !LIQUID_SUPPRESS_ERROR_OUTPUT
+    fprintf(stderr,"warning: ignore potential errors here; checking for invalid configurations\n");
+#endif
+    CONTEND_ISNULL(firfarrow_rrrf_create( 1, 4, 0.45f, 60.0f))
+    CONTEND_ISNULL(firfarrow_rrrf_create(19, 0, 0.45f, 60.0f))
+
+    firfarrow_rrrf q = firfarrow_rrrf_create(19, 4, 0.45f, 60.0f);
+    float x[2]  = {1.0f, 2.0f};
+    float mu[2] = {0.0f, 1.5f};
+    float y[2];
+    CONTEND_INEQUALITY(LIQUID_OK, firfarrow_rrrf_set_delay(q, -1.5f))
+    CONTEND_INEQUALITY(LIQUID_OK, firfarrow_rrrf_execute_block_delay(q, x, mu, 2, y))
+    firfarrow_rrrf_destroy(q);
+}
@@ -67,3 +67,63 @@ void autotest_firfilt_crcf_copy()
     firfilt_crcf_destroy(filt_copy);
 }
 
+
+// copies share coefficients until one of them is re-designed
+void autotest_firfilt_crcf_copy_recreate()
+{
+    // design filter and make copy which shares its coefficients
+    float h0[9] = {1, 2, 3, 4, 5, 4, 3, 2, 1};
+    float h1[5] = {-1, 0, 1, 0, -1};
+    firfilt_crcf filt_orig = firfilt_crcf_create(h0, 9);
+    firfilt_crcf filt_copy = firfilt_crcf_copy(filt_orig);
+
+    // re-create the copy with a different filter of a different length
+    filt_copy = firfilt_crcf_recreate(filt_copy, h1, 5);
+
+    // run impulse through both; each must retain its own response
+    unsigned int i;
+    float complex y_orig, y_copy;
+    for (i=0; i<9; i++) {
+        float complex x = i==0 ? 1.0f : 0.0f;
+        firfilt_crcf_execute_one(filt_orig, x, &y_orig);
+        firfilt_crcf_execute_one(filt_copy, x, &y_copy);
+        CONTEND_EQUALITY(y_orig, h0[i]);
+        CONTEND_EQUALITY(y_copy, i < 5 ? h1[i] : 0.0f);
+    }
+
+    // destroy the original first; the copy must remain usable
+    firfilt_crcf_destroy(filt_orig);
+    firfilt_crcf_execute_one(filt_copy, 1.0f, &y_copy);
+    CONTEND_EQUALITY(y_copy, -1.0f);
+    firfilt_crcf_destroy(filt_copy);
+}
+
+// filters designed independently with identical taps share coefficients
+void autotest_firfilt_crcf_create_shared()
+{
+    float h0[5] = {1, 2, 3, 4, 5};
+    float h1[3] = {1, -1, 2};
+    firfilt_crcf q0 = firfilt_crcf_create(h0, 5);
+    firfilt_crcf q1 = firfilt_crcf_create(h0, 5);
+    CONTEND_EQUALITY(firfilt_crcf_get_coefficients(q0) ==
+                     firfilt_crcf_get_coefficients(q1), 1);
+
+    // re-create the first from its own (shared) coefficients, then again with
+    // different ones; the second filter must keep its response
+    q0 = firfilt_crcf_recreate(q0, (float*)firfilt_crcf_get_coefficients(q0), 5);
+    q0 = firfilt_crcf_recreate(q0, h1, 3);
+    // NOTE: re-created coefficients are stored in reverse order
+    const float * h = firfilt_crcf_get_coefficients(q0);
+    unsigned int i;
+    for (i=0; i<3; i++)
+        CONTEND_EQUALITY(h[2-i], h1[i]);
+
+    // destroy the second filter first; the first must remain usable
+    firfilt_crcf_destroy(q1);
+    float complex y;
+    for (i=0; i<3; i++) {
+        firfilt_crcf_execute_one(q0, i==0 ? 1.0f : 0.0f, &y);
+        CONTEND_EQUALITY(y, h1[i]);
+    }
+    firfilt_crcf_destroy(q0);
+}
@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) 2007 - 2025 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+
+#include <string.h>
+#include "autotest/autotest.h"
+#include "liquid.h"
+
+// compare multi-channel filter against independent single-channel filters
+void testbench_firfilt_multi_crcf(unsigned int _h_len,
+                                  unsigned int _num_channels)
+{
+    unsigned int M = _num_channels;
+    unsigned int n = 600;   // number of samples per channel
+    float        tol = 1e-5f;
+
+    // create multi-channel filter and reference filters
+    firfilt_multi_crcf q = firfilt_multi_crcf_create_kaiser(_h_len, 0.2f, 60.0f, 0.0f, M);
+    firfilt_crcf r[M];
+    unsigned int c, i;
+    for (c=0; c<M; c++) {
+        r[c] = firfilt_crcf_create_kaiser(_h_len, 0.2f, 60.0f, 0.0f);
+        firfilt_crcf_set_scale(r[c], 0.5f);
+    }
+    firfilt_multi_crcf_set_scale(q, 0.5f);
+    CONTEND_EQUALITY(firfilt_multi_crcf_get_num_channels(q), M);
+    CONTEND_EQUALITY(firfilt_multi_crcf_get_length(q), _h_len);
+
+    // generate sample-major input
+    float complex x[n*M], y[n*M], y_ref;
+    for (i=0; i<n*M; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+
+    // run multi-channel filter in two blocks, the second one in place
+    firfilt_multi_crcf_execute_block(q, x, n/3, y);
+    memmove(y + (n/3)*M, x + (n/3)*M, (n - n/3)*M*sizeof(float complex));
+    firfilt_multi_crcf_execute_block(q, y + (n/3)*M, n - n/3, y + (n/3)*M);
+
+    // compare with reference filters
+    for (i=0; i<n; i++) {
+        for (c=0; c<M; c++) {
+            firfilt_crcf_execute_one(r[c], x[i*M+c], &y_ref);
+            CONTEND_DELTA(crealf(y[i*M+c]), crealf(y_ref), tol);
+            CONTEND_DELTA(cimagf(y[i*M+c]), cimagf(y_ref), tol);
+        }
+    }
+
+    // continue with channel-major input and compare again
+    firfilt_multi_crcf_execute_block_channel_major(q, x, n, y);
+    for (c=0; c<M; c++) {
+        for (i=0; i<n; i++) {
+            firfilt_crcf_execute_one(r[c], x[c*n+i], &y_ref);
+            CONTEND_DELTA(crealf(y[c*n+i]), crealf(y_ref), tol);
+            CONTEND_DELTA(cimagf(y[c*n+i]), cimagf(y_ref), tol);
+        }
+    }
+
+    // clean up objects
+    firfilt_multi_crcf_destroy(q);
+    for (c=0; c<M; c++)
+        firfilt_crcf_destroy(r[c]);
+}
+
+void autotest_firfilt_multi_crcf_h2_c1()   { testbench_firfilt_multi_crcf( 2,  1); }
+void autotest_firfilt_multi_crcf_h7_c4()   { testbench_firfilt_multi_crcf( 7,  4); }
+void autotest_firfilt_multi_crcf_h21_c16() { testbench_firfilt_multi_crcf(21, 16); }
+void autotest_firfilt_multi_crcf_h57_c33() { testbench_firfilt_multi_crcf(57, 33); }
+
+// all channels share one set of coefficients: with non-symmetric complex
+// taps, a staggered impulse on each channel yields the same (scaled and
+// delayed) response, and a scale change applies to every channel alike
+void autotest_firfilt_multi_cccf_shared()
+{
+    unsigned int M = 6;
+    unsigned int h_len = 9;
+    unsigned int n = 3*h_len;
+    float complex h[h_len];
+    unsigned int c, i;
+    for (i=0; i<h_len; i++)
+        h[i] = randnf() + _Complex_I*randnf();
+
+    // create multi-channel filter and independent reference filters
+    firfilt_multi_cccf q = firfilt_multi_cccf_create(h, h_len, M);
+    firfilt_cccf r[M];
+    for (c=0; c<M; c++)
+        r[c] = firfilt_cccf_create(h, h_len);
+
+    // channel c gets impulse of amplitude c+1 at time c
+    float complex x[n*M], y[n*M], y_ref;
+    for (i=0; i<n; i++) {
+        for (c=0; c<M; c++)
+            x[i*M+c] = (i == c) ? (float)(c+1) : 0.0f;
+    }
+    firfilt_multi_cccf_execute_block(q, x, n, y);
+    for (i=0; i<n; i++) {
+        for (c=0; c<M; c++) {
+            float complex v = (i >= c && i-c < h_len) ? (c+1)*h[i-c] : 0.0f;
+            CONTEND_DELTA(crealf(y[i*M+c]), crealf(v), 1e-5f);
+            CONTEND_DELTA(cimagf(y[i*M+c]), cimagf(v), 1e-5f);
+
+            // keep reference filters in step
+            firfilt_cccf_execute_one(r[c], x[i*M+c], &y_ref);
+            CONTEND_DELTA(cabsf(y_ref - v), 0.0f, 1e-5f);
+        }
+    }
+
+    // scale applies to all channels; compare with independent filters
+    float complex scale = 0.5f - 0.25f*_Complex_I;
+    firfilt_multi_cccf_set_scale(q, scale);
+    for (c=0; c<M; c++)
+        firfilt_cccf_set_scale(r[c], scale);
+    for (i=0; i<n*M; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+    firfilt_multi_cccf_execute_block(q, x, n, y);
+    for (i=0; i<n; i++) {
+        for (c=0; c<M; c++) {
+            firfilt_cccf_execute_one(r[c], x[i*M+c], &y_ref);
+            CONTEND_DELTA(crealf(y[i*M+c]), crealf(y_ref), 1e-5f);
+            CONTEND_DELTA(cimagf(y[i*M+c]), cimagf(y_ref), 1e-5f);
+        }
+    }
+
+    firfilt_multi_cccf_destroy(q);
+    for (c=0; c<M; c++)
+        firfilt_cccf_destroy(r[c]);
+}
+
+// test complex coefficients on a single-sample interface, copy, and reset
+void autotest_firfilt_multi_cccf_copy()
+{
+    unsigned int M = 5;
+    unsigned int h_len = 13;
+    float complex h[h_len];
+    unsigned int c, i;
+    for (i=0; i<h_len; i++)
+        h[i] = randnf() + _Complex_I*randnf();
+    firfilt_multi_cccf q = firfilt_multi_cccf_create(h, h_len, M);
+    firfilt_cccf       r = firfilt_cccf_create(h, h_len);
+
+    // run samples through filter; channel 2 should match reference
+    float complex x[M], y[M], y_ref;
+    for (i=0; i<40; i++) {
+        for (c=0; c<M; c++)
+            x[c] = randnf() + _Complex_I*randnf();
+        firfilt_multi_cccf_execute(q, x, y);
+        firfilt_cccf_execute_one(r, x[2], &y_ref);
+        CONTEND_DELTA(crealf(y[2]), crealf(y_ref), 1e-5f);
+        CONTEND_DELTA(cimagf(y[2]), cimagf(y_ref), 1e-5f);
+    }
+
+    // copy and run both in parallel
+    firfilt_multi_cccf q_copy = firfilt_multi_cccf_copy(q);
+    float complex y_copy[M];
+    for (i=0; i<40; i++) {
+        for (c=0; c<M; c++)
+            x[c] = randnf() + _Complex_I*randnf();
+        firfilt_multi_cccf_execute(q,      x, y);
+        firfilt_multi_cccf_execute(q_copy, x, y_copy);
+        for (c=0; c<M; c++)
+            CONTEND_EQUALITY(y[c], y_copy[c]);
+    }
+
+    // reset a single channel; impulse response should equal coefficients
+    firfilt_multi_cccf_reset_channel(q, 3);
+    for (i=0; i<h_len; i++) {
+        for (c=0; c<M; c++)
+            x[c] = (c == 3 && i == 0) ? 1.0f : 0.0f;
+        firfilt_multi_cccf_execute(q,      x, y);
+        firfilt_multi_cccf_execute(q_copy, x, y_copy);
+        CONTEND_DELTA(crealf(y[3]), crealf(h[i]), 1e-6f);
+        CONTEND_DELTA(cimagf(y[3]), cimagf(h[i]), 1e-6f);
+        CONTEND_EQUALITY(y[0], y_copy[0]);
+    }
+
+    firfilt_multi_cccf_destroy(q);
+    firfilt_multi_cccf_destroy(q_copy);
+    firfilt_cccf_destroy(r);
+}
+
+// test configuration errors
+void autotest_firfilt_multi_config()
+{
+#if LIQUID_STRICT_EXIT
+    AUTOTEST_WARN("skipping firfilt_multi config test with strict exit enabled\n");
+    return;
+#endif
+#if !LIQUID_SUPPRESS_ERROR_OUTPUT
+    fprintf(stderr,"warning: ignore potential errors here; checking for invalid configurations\n");
+#endif
+    float h[3] = {1,2,3};
+    CONTEND_ISNULL(firfilt_multi_rrrf_create(h, 0, 4));
+    CONTEND_ISNULL(firfilt_multi_rrrf_create(h, 3, 0));
+    CONTEND_ISNULL(firfilt_multi_rrrf_create_kaiser(0, 0.2f, 60.0f, 0.0f, 4));
+    CONTEND_ISNULL(firfilt_multi_rrrf_create_kaiser(21, 0.2f, 60.0f, 0.0f, 0));
+    CONTEND_ISNULL(firfilt_multi_rrrf_copy(NULL));
+
+    firfilt_multi_rrrf q = firfilt_multi_rrrf_create(h, 3, 4);
+    CONTEND_EQUALITY(firfilt_multi_rrrf_reset_channel(q, 4), LIQUID_EIRANGE);
+    CONTEND_EQUALITY(firfilt_multi_rrrf_print(q), LIQUID_OK);
+    float scale = 0.0f;
+    firfilt_multi_rrrf_set_scale(q, 2.5f);
+    firfilt_multi_rrrf_get_scale(q, &scale);
+    CONTEND_EQUALITY(scale, 2.5f);
+    firfilt_multi_rrrf_destroy(q);
+}
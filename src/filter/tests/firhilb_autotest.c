@@ -264,3 +264,73 @@ void autotest_firhilbf_copy_decim()
     firhilbf_destroy(q1);
 }
 
+
+// compare block methods against sample-by-sample execution, using odd
+// block sizes to exercise phase alignment and partial passes
+void autotest_firhilbf_block()
+{
+    unsigned int m = 7, num_blocks = 6, n = 601;
+    unsigned int i, b;
+    firhilbf q0 = firhilbf_create(m, 60.0f);
+    firhilbf q1 = firhilbf_create(m, 60.0f);
+
+    // generate pseudo-random real and complex inputs
+    float         xr[2*n];
+    float complex xc[2*n];
+    for (i=0; i<2*n; i++) {
+        xr[i] = cosf(0.0123f*(float)(i*i % 1009)) + 0.1f*(float)(i % 7);
+        xc[i] = xr[i] + _Complex_I*sinf(0.037f*(float)(i*i % 509));
+    }
+
+    // real to complex
+    float complex y0[2*n], y1[2*n];
+    for (i=0; i<n; i++)
+        firhilbf_r2c_execute(q0, xr[i], y0+i);
+    for (b=0, i=0; b<num_blocks; b++) {
+        unsigned int k = b==num_blocks-1 ? n-i : (b*b*37 + 1) % 211;
+        firhilbf_r2c_execute_block(q1, xr+i, k, y1+i);
+        i += k;
+    }
+    CONTEND_SAME_DATA(y0, y1, n*sizeof(float complex));
+
+    // complex to real
+    float z0[2*n], z1[2*n], z2[2*n], z3[2*n];
+    firhilbf_reset(q0);
+    firhilbf_reset(q1);
+    for (i=0; i<n; i++)
+        firhilbf_c2r_execute(q0, xc[i], z0+i, z1+i);
+    for (b=0, i=0; b<num_blocks; b++) {
+        unsigned int k = b==num_blocks-1 ? n-i : (b*b*37 + 1) % 211;
+        firhilbf_c2r_execute_block(q1, xc+i, k, z2+i, z3+i);
+        i += k;
+    }
+    CONTEND_SAME_DATA(z0, z2, n*sizeof(float));
+    CONTEND_SAME_DATA(z1, z3, n*sizeof(float));
+
+    // decimator
+    firhilbf_reset(q0);
+    firhilbf_reset(q1);
+    for (i=0; i<n; i++)
+        firhilbf_decim_execute(q0, xr+2*i, y0+i);
+    for (b=0, i=0; b<num_blocks; b++) {
+        unsigned int k = b==num_blocks-1 ? n-i : (b*b*37 + 1) % 211;
+        firhilbf_decim_execute_block(q1, xr+2*i, k, y1+i);
+        i += k;
+    }
+    CONTEND_SAME_DATA(y0, y1, n*sizeof(float complex));
+
+    // interpolator
+    firhilbf_reset(q0);
+    firhilbf_reset(q1);
+    for (i=0; i<n; i++)
+        firhilbf_interp_execute(q0, xc[i], z0+2*i);
+    for (b=0, i=0; b<num_blocks; b++) {
+        unsigned int k = b==num_blocks-1 ? n-i : (b*b*37 + 1) % 211;
+        firhilbf_interp_execute_block(q1, xc+i, k, z1+2*i);
+        i += k;
+    }
+    CONTEND_SAME_DATA(z0, z1, 2*n*sizeof(float));
+
+    firhilbf_destroy(q0);
+    firhilbf_destroy(q1);
+}
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2007 - 2025 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include <string.h>
+#include "autotest/autotest.h"
+#include "liquid.h"
+
+// compare multi-channel filter against independent single-channel filters
+void testbench_iirfilt_multi_crcf(unsigned int _order,
+                                  unsigned int _num_channels)
+{
+    unsigned int M = _num_channels;
+    unsigned int n = 240;   // number of samples per channel
+    float        tol = 1e-6f;
+
+    // create multi-channel filter and reference filters
+    iirfilt_multi_crcf q = iirfilt_multi_crcf_create_prototype(
+        LIQUID_IIRDES_ELLIP, LIQUID_IIRDES_LOWPASS, _order, 0.1f, 0.0f, 0.5f, 60.0f, M);
+    iirfilt_crcf r[M];
+    unsigned int c, i;
+    for (c=0; c<M; c++) {
+        r[c] = iirfilt_crcf_create_prototype(LIQUID_IIRDES_ELLIP, LIQUID_IIRDES_LOWPASS,
+            LIQUID_IIRDES_SOS, _order, 0.1f, 0.0f, 0.5f, 60.0f);
+        iirfilt_crcf_set_scale(r[c], 0.5f);
+    }
+    iirfilt_multi_crcf_set_scale(q, 0.5f);
+    CONTEND_EQUALITY(iirfilt_multi_crcf_get_num_channels(q), M);
+
+    // generate sample-major input
+    float complex x[n*M], y[n*M], y_ref;
+    for (i=0; i<n*M; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+
+    // run multi-channel filter in two blocks, the second one in place
+    iirfilt_multi_crcf_execute_block(q, x, n/3, y);
+    memmove(y + (n/3)*M, x + (n/3)*M, (n - n/3)*M*sizeof(float complex));
+    iirfilt_multi_crcf_execute_block(q, y + (n/3)*M, n - n/3, y + (n/3)*M);
+
+    // compare with reference filters
+    for (i=0; i<n; i++) {
+        for (c=0; c<M; c++) {
+            iirfilt_crcf_execute(r[c], x[i*M+c], &y_ref);
+            CONTEND_DELTA(crealf(y[i*M+c]), crealf(y_ref), tol);
+            CONTEND_DELTA(cimagf(y[i*M+c]), cimagf(y_ref), tol);
+        }
+    }
+
+    // clean up objects
+    iirfilt_multi_crcf_destroy(q);
+    for (c=0; c<M; c++)
+        iirfilt_crcf_destroy(r[c]);
+}
+
+void autotest_iirfilt_multi_crcf_o1_c1()  { testbench_iirfilt_multi_crcf(1,  1); }
+void autotest_iirfilt_multi_crcf_o4_c7()  { testbench_iirfilt_multi_crcf(4,  7); }
+void autotest_iirfilt_multi_crcf_o5_c16() { testbench_iirfilt_multi_crcf(5, 16); }
+void autotest_iirfilt_multi_crcf_o8_c33() { testbench_iirfilt_multi_crcf(8, 33); }
+
+// test DC blocker on a real-valued multi-channel input
+void autotest_iirfilt_multi_rrrf_dc_blocker()
+{
+    unsigned int M = 12;
+    unsigned int n = 1200;
+    float        alpha = 0.02f;
+    iirfilt_multi_rrrf q = iirfilt_multi_rrrf_create_dc_blocker(alpha, M);
+    iirfilt_rrrf       r = iirfilt_rrrf_create_dc_blocker(alpha);
+
+    // apply constant per-channel DC offset plus noise
+    float x[M], y[M], y_ref = 0.0f;
+    unsigned int c, i;
+    for (i=0; i<n; i++) {
+        for (c=0; c<M; c++)
+            x[c] = (float)c - 4.0f + 0.1f*randnf();
+        iirfilt_multi_rrrf_execute(q, x, y);
+
+        // channel 0 should match single-channel DC blocker
+        iirfilt_rrrf_execute(r, x[0], &y_ref);
+        CONTEND_DELTA(y[0], y_ref, 1e-5f);
+    }
+
+    // DC offset should be removed from all channels
+    for (c=0; c<M; c++)
+        CONTEND_DELTA(y[c], 0.0f, 0.5f);
+
+    // reset a single channel and ensure others are unaffected
+    iirfilt_multi_rrrf q_copy = iirfilt_multi_rrrf_copy(q);
+    iirfilt_multi_rrrf_reset_channel(q, 3);
+    for (c=0; c<M; c++)
+        x[c] = 1.0f;
+    float y_copy[M];
+    iirfilt_multi_rrrf_execute(q,      x, y);
+    iirfilt_multi_rrrf_execute(q_copy, x, y_copy);
+    for (c=0; c<M; c++) {
+        if (c == 3) {
+            CONTEND_DELTA(y[c], sqrtf(1-alpha), 1e-6f);
+        } else {
+            CONTEND_EQUALITY(y[c], y_copy[c]);
+        }
+    }
+
+    iirfilt_multi_rrrf_destroy(q);
+    iirfilt_multi_rrrf_destroy(q_copy);
+    iirfilt_rrrf_destroy(r);
+}
+
+// test configuration errors
+void autotest_iirfilt_multi_config()
+{
+#if LIQUID_STRICT_EXIT
+    AUTOTEST_WARN("skipping iirfilt_multi config test with strict exit enabled\n");
+    return;
+#endif
+#if !LIQUID_SUPPRESS_ERROR_OUTPUT
+    fprintf(stderr,"warning: ignore potential errors here; checking for invalid configurations\n");
+#endif
+    float B[3] = {1,0,0};
+    float A[3] = {1,0,0};
+    CONTEND_ISNULL(iirfilt_multi_rrrf_create_sos(B, A, 0, 4));
+    CONTEND_ISNULL(iirfilt_multi_rrrf_create_sos(B, A, 1, 0));
+    CONTEND_ISNULL(iirfilt_multi_rrrf_create_dc_blocker(0.0f, 4));
+
+    iirfilt_multi_rrrf q = iirfilt_multi_rrrf_create_lowpass(3, 0.1f, 4);
+    CONTEND_EQUALITY(iirfilt_multi_rrrf_reset_channel(q, 4), LIQUID_EIRANGE);
+    CONTEND_EQUALITY(iirfilt_multi_rrrf_print(q), LIQUID_OK);
+    float scale = 0.0f;
+    iirfilt_multi_rrrf_set_scale(q, 2.5f);
+    iirfilt_multi_rrrf_get_scale(q, &scale);
+    CONTEND_EQUALITY(scale, 2.5f);
+    iirfilt_multi_rrrf_destroy(q);
+}
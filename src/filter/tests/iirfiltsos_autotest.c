@@ -169,6 +169,71 @@ void autotest_iirfiltsos_copy()
     iirfiltsos_crcf_destroy(q1);
 }
 
+// compare look-ahead block execution against direct form II
+void testbench_iirfiltsos_crcf_block(float * _b, float * _a)
+{
+    iirfiltsos_crcf q0 = iirfiltsos_crcf_create(_b,_a);
+    iirfiltsos_crcf q1 = iirfiltsos_crcf_create(_b,_a);
+
+    // generate random input
+    unsigned int i, n = 500;
+    float complex x[n], y0[n], y1[n];
+    for (i=0; i<n; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+
+    // run direct form II
+    for (i=0; i<n; i++)
+        iirfiltsos_crcf_execute_df2(q0, x[i], &y0[i]);
+
+    // run block method with irregular sizes, interleaving single samples
+    unsigned int block_len[] = {3, 8, 17, 1, 64, 200, 7, 200};
+    unsigned int k = 0;
+    for (i=0; i<8; i++) {
+        if (block_len[i] == 1) {
+            iirfiltsos_crcf_execute(q1, x[k], &y1[k]);
+        } else {
+            iirfiltsos_crcf_execute_block(q1, &x[k], block_len[i], &y1[k]);
+        }
+        k += block_len[i];
+    }
+    CONTEND_EQUALITY(k, n);
+
+    // compare results
+    float tol = 1e-4f;
+    for (i=0; i<n; i++) {
+        CONTEND_DELTA(crealf(y0[i]), crealf(y1[i]), tol);
+        CONTEND_DELTA(cimagf(y0[i]), cimagf(y1[i]), tol);
+    }
+
+    iirfiltsos_crcf_destroy(q0);
+    iirfiltsos_crcf_destroy(q1);
+}
+
+void autotest_iirfiltsos_block_lowpass()
+{
+    // 2nd-order low-pass butterworth filter
+    float b[3] = {0.0976310729378175, 0.1952621458756350, 0.0976310729378175};
+    float a[3] = {1.000000000000000, -0.942809041582063,  0.333333333333333};
+    testbench_iirfiltsos_crcf_block(b, a);
+}
+
+void autotest_iirfiltsos_block_resonator()
+{
+    // narrow resonator with poles close to the unit circle
+    float r = 0.995f, w = 0.3f;
+    float b[3] = {1.0f - r, 0.0f, 0.0f};
+    float a[3] = {1.0f, -2.0f*r*cosf(w), r*r};
+    testbench_iirfiltsos_crcf_block(b, a);
+}
+
+void autotest_iirfiltsos_block_unnormalized()
+{
+    // coefficients with a[0] != 1
+    float b[3] = {0.4f, -0.2f, 0.1f};
+    float a[3] = {2.0f,  0.6f, 0.3f};
+    testbench_iirfiltsos_crcf_block(b, a);
+}
+
 // test errors and invalid configuration
 void autotest_iirfiltsos_config()
 {
@@ -54,3 +54,43 @@ void autotest_ordfilt_copy()
     ordfilt_rrrf_destroy(q1);
 }
 
+
+// compare order statistic against sorted copy of input window
+void testbench_ordfilt_rrrf(unsigned int _n, unsigned int _k)
+{
+    ordfilt_rrrf q = ordfilt_rrrf_create(_n, _k);
+
+    // generate random input with repeated values
+    unsigned int i, j, num_samples = 3*_n + 50;
+    float x[num_samples], y[num_samples];
+    for (i=0; i<num_samples; i++)
+        x[i] = (i % 7) == 0 ? 0.5f : randnf();
+
+    // run filter on block
+    ordfilt_rrrf_execute_block(q, x, num_samples, y);
+
+    // compare against brute force: window of last _n samples, zero padded
+    float w[_n];
+    for (i=0; i<num_samples; i++) {
+        for (j=0; j<_n; j++)
+            w[j] = i+j+1 >= _n ? x[i+j+1-_n] : 0.0f;
+
+        // count values less than and no greater than output
+        unsigned int num_lt = 0, num_le = 0;
+        for (j=0; j<_n; j++) {
+            num_lt += w[j] <  y[i] ? 1 : 0;
+            num_le += w[j] <= y[i] ? 1 : 0;
+        }
+        CONTEND_LESS_THAN   (num_lt, _k+1);
+        CONTEND_GREATER_THAN(num_le, _k);
+    }
+
+    ordfilt_rrrf_destroy(q);
+}
+
+void autotest_ordfilt_rrrf_n1_k0()     { testbench_ordfilt_rrrf(  1,   0); }
+void autotest_ordfilt_rrrf_n2_k1()     { testbench_ordfilt_rrrf(  2,   1); }
+void autotest_ordfilt_rrrf_n9_k0()     { testbench_ordfilt_rrrf(  9,   0); }
+void autotest_ordfilt_rrrf_n9_k8()     { testbench_ordfilt_rrrf(  9,   8); }
+void autotest_ordfilt_rrrf_n17_k5()    { testbench_ordfilt_rrrf( 17,   5); }
+void autotest_ordfilt_rrrf_n255_k127() { testbench_ordfilt_rrrf(255, 127); }
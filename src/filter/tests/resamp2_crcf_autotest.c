@@ -290,3 +290,79 @@ void autotest_resamp2_copy()
     resamp2_crcf_destroy(qb);
 }
 
+
+// test block decimation matches sample-by-sample operation
+void testbench_resamp2_crcf_decim_block(unsigned int _m, float _f0)
+{
+    // create two identical half-band resamplers
+    resamp2_crcf qa = resamp2_crcf_create(_m, _f0, 60.0f);
+    resamp2_crcf qb = resamp2_crcf_create(_m, _f0, 60.0f);
+    resamp2_crcf_set_scale(qa, 0.7f);
+    resamp2_crcf_set_scale(qb, 0.7f);
+
+    // generate random input
+    unsigned int i, n = 1200;
+    float complex x[2*n], ya[n], yb[n];
+    for (i=0; i<2*n; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+
+    // run sample-by-sample
+    for (i=0; i<n; i++)
+        resamp2_crcf_decim_execute(qa, &x[2*i], &ya[i]);
+
+    // run in blocks of irregular size to test state continuity
+    unsigned int block_len[] = {1, 2, 3, 17, 300, 5, 600, 272};
+    unsigned int k = 0;
+    for (i=0; i<8; i++) {
+        resamp2_crcf_decim_execute_block(qb, &x[2*k], block_len[i], &yb[k]);
+        k += block_len[i];
+    }
+    CONTEND_EQUALITY(k, n);
+    CONTEND_SAME_DATA(ya, yb, n*sizeof(float complex));
+
+    // clean up allocated objects
+    resamp2_crcf_destroy(qa);
+    resamp2_crcf_destroy(qb);
+}
+void autotest_resamp2_decim_block_m2()    { testbench_resamp2_crcf_decim_block( 2,  0.00f); }
+void autotest_resamp2_decim_block_m7()    { testbench_resamp2_crcf_decim_block( 7,  0.00f); }
+void autotest_resamp2_decim_block_m12f0() { testbench_resamp2_crcf_decim_block(12,  0.17f); }
+void autotest_resamp2_decim_block_m40f0() { testbench_resamp2_crcf_decim_block(40, -0.23f); }
+
+// test block interpolation matches sample-by-sample operation
+void testbench_resamp2_crcf_interp_block(unsigned int _m, float _f0)
+{
+    // create two identical half-band resamplers
+    resamp2_crcf qa = resamp2_crcf_create(_m, _f0, 60.0f);
+    resamp2_crcf qb = resamp2_crcf_create(_m, _f0, 60.0f);
+    resamp2_crcf_set_scale(qa, 1.3f);
+    resamp2_crcf_set_scale(qb, 1.3f);
+
+    // generate random input
+    unsigned int i, n = 1200;
+    float complex x[n], ya[2*n], yb[2*n];
+    for (i=0; i<n; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+
+    // run sample-by-sample
+    for (i=0; i<n; i++)
+        resamp2_crcf_interp_execute(qa, x[i], &ya[2*i]);
+
+    // run in blocks of irregular size to test state continuity
+    unsigned int block_len[] = {1, 2, 3, 17, 300, 5, 600, 272};
+    unsigned int k = 0;
+    for (i=0; i<8; i++) {
+        resamp2_crcf_interp_execute_block(qb, &x[k], block_len[i], &yb[2*k]);
+        k += block_len[i];
+    }
+    CONTEND_EQUALITY(k, n);
+    CONTEND_SAME_DATA(ya, yb, 2*n*sizeof(float complex));
+
+    // clean up allocated objects
+    resamp2_crcf_destroy(qa);
+    resamp2_crcf_destroy(qb);
+}
+void autotest_resamp2_interp_block_m2()    { testbench_resamp2_crcf_interp_block( 2,  0.00f); }
+void autotest_resamp2_interp_block_m7()    { testbench_resamp2_crcf_interp_block( 7,  0.00f); }
+void autotest_resamp2_interp_block_m12f0() { testbench_resamp2_crcf_interp_block(12,  0.17f); }
+void autotest_resamp2_interp_block_m40f0() { testbench_resamp2_crcf_interp_block(40, -0.23f); }
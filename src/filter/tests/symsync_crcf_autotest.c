@@ -185,3 +185,43 @@ void autotest_symsync_crcf_scenario_5() { symsync_crcf_test("nyquist", 2, 7, 0.3
 void autotest_symsync_crcf_scenario_6() { symsync_crcf_test("nyquist", 2, 7, 0.35, -0.25, 1.0001f ); }
 void autotest_symsync_crcf_scenario_7() { symsync_crcf_test("nyquist", 2, 7, 0.35, -0.25, 0.9999f ); }
 
+
+// output must not depend upon how the input is partitioned into blocks
+void autotest_symsync_crcf_block_partition()
+{
+    unsigned int num_samples = 2400;
+    symsync_crcf q0 = symsync_crcf_create_rnyquist(LIQUID_FIRFILT_RRC, 2, 7, 0.3f, 32);
+    symsync_crcf_set_lf_bw(q0, 0.05f);
+    symsync_crcf_set_output_rate(q0, 2);
+    symsync_crcf q1 = symsync_crcf_copy(q0);
+
+    // random input
+    float complex x[num_samples];
+    unsigned int i;
+    for (i=0; i<num_samples; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+
+    // run entire block through first object
+    float complex y0[2*num_samples];
+    unsigned int  n0 = 0;
+    symsync_crcf_execute(q0, x, num_samples, y0, &n0);
+
+    // run irregular blocks (including single samples) through second object
+    float complex y1[2*num_samples];
+    unsigned int  n1 = 0, nw = 0, n = 0;
+    unsigned int  block_sizes[] = {1, 2, 3, 17, 300, 1, 600, 77};
+    unsigned int  s = 0;
+    for (i=0; i<num_samples; i+=n) {
+        n = block_sizes[s++ % 8];
+        n = (i + n > num_samples) ? num_samples - i : n;
+        symsync_crcf_execute(q1, x+i, n, y1+n1, &nw);
+        n1 += nw;
+    }
+
+    CONTEND_EQUALITY(n0, n1);
+    CONTEND_SAME_DATA(y0, y1, n0*sizeof(float complex));
+    CONTEND_EQUALITY(symsync_crcf_get_tau(q0), symsync_crcf_get_tau(q1));
+
+    symsync_crcf_destroy(q0);
+    symsync_crcf_destroy(q1);
+}
@@ -49,6 +49,52 @@
 
 #define LIQUID_DEBUG_NCO            (0)
 
+// sine and cosine of 32-bit phase t for type LIQUID_NCO, rounding phase
+// to nearest table index as NCO(_static_index)
+#define NCO_SINCOS_NCO(tab, t, vsin, vcos)                              \
+    {                                                                   \
+        unsigned int index = (((t) + (1U << (shift-1))) >> shift) & mask; \
+        vsin = tab[index];                                              \
+        vcos = tab[NCO_STATIC_LUT_INDEX_SHIFTED_PI2(index)];            \
+    }
+
+// sine and cosine of 32-bit phase t for type LIQUID_VCO_INTERP,
+// truncating phase to table index and interpolating the remainder
+#define NCO_SINCOS_VCOI(tab, t, vsin, vcos)                             \
+    {                                                                   \
+        uint32_t     t_pi2     = NCO_STATIC_LUT_THETA_SHIFTED_PI2(t);   \
+        unsigned int index     = ((t) >> shift) & mask;                 \
+        unsigned int index_pi2 = NCO_STATIC_LUT_INDEX_SHIFTED_PI2(index); \
+        vsin = tab[index].value +                                       \
+               NCO_STATIC_LUT_THETA_ACCUM(t) * tab[index].skew;         \
+        vcos = tab[index_pi2].value +                                   \
+               NCO_STATIC_LUT_THETA_ACCUM(t_pi2) * tab[index_pi2].skew; \
+    }
+
+// Constrain phase step v and convert to fixed-point w, resolving the common
+// case of a step in (-2 pi, 2 pi) inline with a branchless wrap but
+// otherwise identical to NCO(_constrain).
+#define NCO_CONSTRAIN_STEP(v, w)                                        \
+    {                                                                   \
+        T v_wrap = (T)((v) + 2*M_PI);                                   \
+        T v_pos  = (v) < 0 ? v_wrap : (v);                              \
+        w = (v_pos >= 0 && v_pos < 2*M_PI) ?                            \
+            (uint32_t)((v_pos/(2*M_PI)) * 0xffffffff) : NCO(_constrain)(v); \
+    }
+
+// write complex exponential (when x is NULL) or rotated input sample i
+// to interleaved output y
+#define NCO_MIX_BLOCK_OUTPUT(i, vsin, vcos)         \
+    if (x == NULL) {                                \
+        y[2*(i)  ] = vcos;                          \
+        y[2*(i)+1] = vsin;                          \
+    } else {                                        \
+        T xr = x[2*(i)  ];                          \
+        T xi = x[2*(i)+1];                          \
+        y[2*(i)  ] = xr*vcos - xi*vsin;             \
+        y[2*(i)+1] = xr*vsin + xi*vcos;             \
+    }
+
 struct vco_tab_e_s {
     T value, skew;
 };
@@ -95,6 +141,19 @@ T NCO(_fp_cos)(T x);
 // compute index for sine/cosine look-up table
 unsigned int NCO(_static_index)(NCO() _q);
 
+// rotate input vector array up or down by NCO angle
+int NCO(_mix_block)(NCO()        _q,
+                    TC *         _x,
+                    TC *         _y,
+                    unsigned int _n,
+                    int          _down);
+
+// generate linear frequency chirp with fixed-point frequency increment
+int NCO(_chirp_block)(NCO()        _q,
+                      TC *         _y,
+                      unsigned int _n,
+                      uint32_t     _dd);
+
 // create nco/vco object
 NCO() NCO(_create)(liquid_ncotype _type)
 {
@@ -571,6 +630,78 @@ int NCO(_pll_step)(NCO() _q,
     return LIQUID_OK;
 }
 
+// Run phase-locked loop over block of input samples, mixing each sample
+// down by the NCO angle, computing the phase error with the given
+// detector, updating the loop filter, and stepping the phase. This is
+// equivalent to calling NCO(_mix_down), NCO(_pll_step), and NCO(_step)
+// for each sample but keeps the phase and frequency in registers. Results
+// may differ from the per-sample path in the last bits where the compiler
+// contracts multiply-adds differently.
+//  _q          :   nco object
+//  _x          :   input array [size: _n x 1]
+//  _y          :   output array [size: _n x 1]
+//  _n          :   number of input, output samples
+//  _detector   :   phase detector type
+int NCO(_pll_execute_block)(NCO()               _q,
+                            TC *                _x,
+                            TC *                _y,
+                            unsigned int        _n,
+                            liquid_pll_detector _detector)
+{
+    if (_q->type == LIQUID_VCO_DIRECT)
+        return liquid_error(LIQUID_EICONFIG,"nco_%s_pll_execute_block(), cannot be used with object type == LIQUID_VCO_DIRECT", EXTENSION);
+    if (_detector != LIQUID_PLL_DETECTOR_CARRIER     &&
+        _detector != LIQUID_PLL_DETECTOR_COSTAS_BPSK &&
+        _detector != LIQUID_PLL_DETECTOR_COSTAS_QPSK)
+    {
+        return liquid_error(LIQUID_EIMODE,"nco_%s_pll_execute_block(), unknown detector type: %u", EXTENSION, _detector);
+    }
+
+    // read back real/imaginary components of mixed output
+    const T * y = (const T *) _y;
+    const unsigned int shift = NCO_STATIC_LUT_WORDBITS - NCO_STATIC_LUT_NBITS;
+    const unsigned int mask  = NCO_STATIC_LUT_SIZE - 1;
+    uint32_t theta   = _q->theta;
+    uint32_t d_theta = _q->d_theta;
+    unsigned int i;
+    for (i=0; i<_n; i++) {
+        // mix down by current phase
+        T vsin, vcos;
+        if (_q->type == LIQUID_NCO) {
+            NCO_SINCOS_NCO(_q->nco_sintab, theta, vsin, vcos);
+        } else {
+            NCO_SINCOS_VCOI(_q->vcoi_sintab, theta, vsin, vcos);
+        }
+        // rotate input (negative direction) as in NCO(_mix_down)
+        _y[i] = _x[i] * CONJ(vcos + _Complex_I*vsin);
+        T yr = y[2*i  ];
+        T yi = y[2*i+1];
+
+        // compute phase error
+        T dphi;
+        switch (_detector) {
+        case LIQUID_PLL_DETECTOR_COSTAS_BPSK:
+            dphi = yr > 0 ? yi : -yi;
+            break;
+        case LIQUID_PLL_DETECTOR_COSTAS_QPSK:
+            dphi = (yr > 0 ? yi : -yi) - (yi > 0 ? yr : -yr);
+            break;
+        default:
+            dphi = ATAN2(yi, yr);
+        }
+
+        // update loop filter and step phase
+        uint32_t df, dp;
+        NCO_CONSTRAIN_STEP(dphi*_q->alpha, df);
+        NCO_CONSTRAIN_STEP(dphi*_q->beta,  dp);
+        d_theta += df;
+        theta   += dp + d_theta;
+    }
+    _q->theta   = theta;
+    _q->d_theta = d_theta;
+    return LIQUID_OK;
+}
+
 // mixing functions
 
 // Rotate input vector up by NCO angle, y = x exp{+j theta}
@@ -610,7 +741,6 @@ int NCO(_mix_down)(NCO() _q,
 
 // Rotate input vector array up by NCO angle:
 //      y(t) = x(t) exp{+j (f*t + theta)}
-// TODO : implement NCO/VCO-specific versions
 //  _q      :   nco object
 //  _x      :   input array [size: _n x 1]
 //  _y      :   output sample [size: _n x 1]
@@ -620,36 +750,11 @@ int NCO(_mix_block_up)(NCO()        _q,
                        TC *         _y,
                        unsigned int _n)
 {
-    unsigned int i;
-    // FIXME: this method should be more efficient but is causing occasional
-    //        errors so instead favor slower but more reliable algorithm
-    //        (anyway it must be rewritten to work with LIQUID_VCO_DIRECT type)
-#if 0
-    T theta =   _q->theta;
-    T d_theta = _q->d_theta;
-    for (i=0; i<_n; i++) {
-        // multiply _x[i] by [cos(theta) + _Complex_I*sin(theta)]
-        _y[i] = _x[i] * liquid_cexpjf(theta);
-
-        theta += d_theta;
-    }
-
-    NCO(_set_phase)(_q, theta);
-#else
-    for (i=0; i<_n; i++) {
-        // mix single sample up
-        NCO(_mix_up)(_q, _x[i], &_y[i]);
-
-        // step NCO phase
-        NCO(_step)(_q);
-    }
-#endif
-    return LIQUID_OK;
+    return NCO(_mix_block)(_q, _x, _y, _n, 0);
 }
 
 // Rotate input vector array down by NCO angle:
 //      y(t) = x(t) exp{-j (f*t + theta)}
-// TODO : implement NCO/VCO-specific versions
 //  _q      :   nco object
 //  _x      :   input array [size: _n x 1]
 //  _y      :   output sample [size: _n x 1]
@@ -659,37 +764,159 @@ int NCO(_mix_block_down)(NCO()        _q,
                          TC *         _y,
                          unsigned int _n)
 {
-    unsigned int i;
-    // FIXME: this method should be more efficient but is causing occasional
-    //        errors so instead favor slower but more reliable algorithm
-    //        (anyway it must be rewritten to work with LIQUID_VCO_DIRECT type)
-#if 0
-    T theta =   _q->theta;
-    T d_theta = _q->d_theta;
-    for (i=0; i<_n; i++) {
-        // multiply _x[i] by [cos(-theta) + _Complex_I*sin(-theta)]
-        _y[i] = _x[i] * liquid_cexpjf(-theta);
-
-        theta += d_theta;
-    }
+    return NCO(_mix_block)(_q, _x, _y, _n, 1);
+}
 
-    NCO(_set_phase)(_q, theta);
-#else
-    for (i=0; i<_n; i++) {
-        // mix single sample down
-        NCO(_mix_down)(_q, _x[i], &_y[i]);
+// Generate complex exponential, stepping phase once per sample:
+//      y(t) = exp{+j (f*t + theta)}
+//  _q      :   nco object
+//  _y      :   output array [size: _n x 1]
+//  _n      :   number of output samples
+int NCO(_generate_block)(NCO()        _q,
+                         TC *         _y,
+                         unsigned int _n)
+{
+    return NCO(_mix_block)(_q, NULL, _y, _n, 0);
+}
 
-        // step NCO phase
-        NCO(_step)(_q);
+// Generate linear frequency chirp, adjusting frequency by _df after each
+// sample; the frequency is retained so that successive calls continue
+// the same chirp:
+//      y(t) = exp{+j (theta + f*t + df*t*(t-1)/2)}
+//  _q      :   nco object
+//  _y      :   output array [size: _n x 1]
+//  _n      :   number of output samples
+//  _df     :   frequency increment per sample [radians/sample^2]
+int NCO(_generate_chirp_block)(NCO()        _q,
+                               TC *         _y,
+                               unsigned int _n,
+                               T            _df)
+{
+    if (_q->type == LIQUID_VCO_DIRECT) {
+        return liquid_error(LIQUID_EICONFIG,"nco_%s_generate_chirp_block(), "
+                       "cannot be used with object type == LIQUID_VCO_DIRECT", EXTENSION);
     }
-#endif
-    return LIQUID_OK;
+
+    // step phase by the current frequency and frequency by _df after
+    // each sample, both on the 32-bit accumulators
+    return NCO(_chirp_block)(_q, _y, _n, NCO(_constrain)(_df));
 }
 
 //
 // internal methods
 //
 
+// Rotate input vector array by NCO angle, stepping phase once per
+// sample. The phase of sample i is computed directly as theta + i*d_theta
+// on the 32-bit accumulator so there is no dependency between iterations,
+// and the look-up, interpolation, and complex multiply are computed in a
+// single pass with the same arithmetic as NCO(_mix_up) and NCO(_mix_down).
+//  _q      :   nco object
+//  _x      :   input array [size: _n x 1], or NULL to generate the
+//              complex exponential itself
+//  _y      :   output sample [size: _n x 1]
+//  _n      :   number of input, output samples
+//  _down   :   rotate down (conjugate phasor)?
+int NCO(_mix_block)(NCO()        _q,
+                    TC *         _x,
+                    TC *         _y,
+                    unsigned int _n,
+                    int          _down)
+{
+    // operate on interleaved real/imaginary components
+    const T * x = (const T *) _x;
+    T *       y = (T *)       _y;
+    T sign = _down ? TIL(-1) : TIL(1);
+    const unsigned int shift = NCO_STATIC_LUT_WORDBITS - NCO_STATIC_LUT_NBITS;
+    const unsigned int mask  = NCO_STATIC_LUT_SIZE - 1;
+    uint32_t theta   = _q->theta;
+    uint32_t d_theta = _q->d_theta;
+    unsigned int i;
+
+    switch (_q->type) {
+    case LIQUID_NCO: {
+        const T * tab = _q->nco_sintab;
+        for (i=0; i<_n; i++) {
+            uint32_t t = theta + (uint32_t)i * d_theta;
+            T vsin, vcos;
+            NCO_SINCOS_NCO(tab, t, vsin, vcos);
+            vsin *= sign;
+            NCO_MIX_BLOCK_OUTPUT(i, vsin, vcos);
+        }
+        _q->theta = theta + (uint32_t)_n * d_theta;
+        break;
+    }
+    case LIQUID_VCO_INTERP: {
+        const vco_tab_e * tab = _q->vcoi_sintab;
+        for (i=0; i<_n; i++) {
+            uint32_t t = theta + (uint32_t)i * d_theta;
+            T vsin, vcos;
+            NCO_SINCOS_VCOI(tab, t, vsin, vcos);
+            vsin *= sign;
+            NCO_MIX_BLOCK_OUTPUT(i, vsin, vcos);
+        }
+        _q->theta = theta + (uint32_t)_n * d_theta;
+        break;
+    }
+    case LIQUID_VCO_DIRECT: {
+        unsigned int k = _q->vcod_index;
+        for (i=0; i<_n; i++) {
+            T vsin = sign * _q->vcod_sintab[k];
+            T vcos = _q->vcod_costab[k];
+            NCO_MIX_BLOCK_OUTPUT(i, vsin, vcos);
+            if (++k == _q->vcod_m)
+                k = 0;
+        }
+        _q->vcod_index = k;
+        break;
+    }
+    default:
+        return liquid_error(LIQUID_EIMODE,"nco_%s_mix_block(), unknown type: %u", EXTENSION, _q->type);
+    }
+    return LIQUID_OK;
+}
+
+// generate linear frequency chirp with 32-bit frequency increment _dd
+//  _q      :   nco object
+//  _y      :   output array [size: _n x 1]
+//  _n      :   number of output samples
+//  _dd     :   frequency increment per sample (fixed point)
+int NCO(_chirp_block)(NCO()        _q,
+                      TC *         _y,
+                      unsigned int _n,
+                      uint32_t     _dd)
+{
+    T * y = (T *) _y;
+    const unsigned int shift = NCO_STATIC_LUT_WORDBITS - NCO_STATIC_LUT_NBITS;
+    const unsigned int mask  = NCO_STATIC_LUT_SIZE - 1;
+    uint32_t theta   = _q->theta;
+    uint32_t d_theta = _q->d_theta;
+    unsigned int i;
+    T vsin, vcos;
+    if (_q->type == LIQUID_NCO) {
+        const T * tab = _q->nco_sintab;
+        for (i=0; i<_n; i++) {
+            NCO_SINCOS_NCO(tab, theta, vsin, vcos);
+            y[2*i  ] = vcos;
+            y[2*i+1] = vsin;
+            theta   += d_theta;
+            d_theta += _dd;
+        }
+    } else {
+        const vco_tab_e * tab = _q->vcoi_sintab;
+        for (i=0; i<_n; i++) {
+            NCO_SINCOS_VCOI(tab, theta, vsin, vcos);
+            y[2*i  ] = vcos;
+            y[2*i+1] = vsin;
+            theta   += d_theta;
+            d_theta += _dd;
+        }
+    }
+    _q->theta   = theta;
+    _q->d_theta = d_theta;
+    return LIQUID_OK;
+}
+
 uint32_t NCO(_constrain)(T _theta)
 {
 #if 0
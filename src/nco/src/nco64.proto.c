@@ -0,0 +1,328 @@
+/*
+ * Copyright (c) 2007 - 2025 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// Numerically-controlled oscillator with 64-bit phase accumulator
+//
+// The phase and frequency are held as 64-bit fixed-point words so the
+// frequency resolution is 2^-64 cycles/sample and an integer frequency
+// word accumulates without drift over arbitrarily long runs. The sine and
+// cosine are evaluated from the upper 32 bits of the phase using the
+// look-up tables of an internal nco object of type LIQUID_NCO or
+// LIQUID_VCO_INTERP.
+//
+
+#include <math.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+struct NCO64(_s) {
+    NCO()       nco;        // nco object holding sine look-up table
+    uint64_t    theta;      // 64-bit phase     [radians]
+    uint64_t    d_theta;    // 64-bit frequency [radians/sample]
+};
+
+// constrain phase (or frequency) and convert to 64-bit fixed-point
+uint64_t NCO64(_constrain)(T _theta);
+
+// rotate input vector array up or down by nco angle
+int NCO64(_mix_block)(NCO64()      _q,
+                      TC *         _x,
+                      TC *         _y,
+                      unsigned int _n,
+                      int          _down);
+
+// create nco object with 64-bit phase accumulator
+NCO64() NCO64(_create)(liquid_ncotype _type)
+{
+    if (_type != LIQUID_NCO && _type != LIQUID_VCO_INTERP)
+        return liquid_error_config("nco64_%s_create(), unsupported type : %u", EXTENSION, _type);
+
+    NCO64() q = (NCO64()) malloc(sizeof(struct NCO64(_s)));
+    q->nco = NCO(_create)(_type);
+
+    // reset object and return
+    NCO64(_reset)(q);
+    return q;
+}
+
+// copy object
+NCO64() NCO64(_copy)(NCO64() q_orig)
+{
+    // validate input
+    if (q_orig == NULL)
+        return liquid_error_config("nco64_%s_copy(), object cannot be NULL", EXTENSION);
+
+    // allocate new object, copy main component memory
+    NCO64() q_copy = (NCO64()) malloc(sizeof(struct NCO64(_s)));
+    memmove(q_copy, q_orig, sizeof(struct NCO64(_s)));
+
+    // copy internal object
+    q_copy->nco = NCO(_copy)(q_orig->nco);
+    return q_copy;
+}
+
+// destroy nco object
+int NCO64(_destroy)(NCO64() _q)
+{
+    if (_q == NULL)
+        return liquid_error(LIQUID_EIOBJ,"nco64_%s_destroy(), object is null", EXTENSION);
+    NCO(_destroy)(_q->nco);
+    free(_q);
+    return LIQUID_OK;
+}
+
+// print nco object internals to stdout
+int NCO64(_print)(NCO64() _q)
+{
+    printf("<liquid.nco64_%s", EXTENSION);
+    printf(", type=\"%s\"", _q->nco->type == LIQUID_NCO ? "nco" : "vco");
+    printf(", phase=0x%.16llx", (unsigned long long)_q->theta);
+    printf(", freq=0x%.16llx",  (unsigned long long)_q->d_theta);
+    printf(">\n");
+    return LIQUID_OK;
+}
+
+// reset phase and frequency to zero
+int NCO64(_reset)(NCO64() _q)
+{
+    _q->theta   = 0;
+    _q->d_theta = 0;
+    return LIQUID_OK;
+}
+
+// set frequency [radians/sample]
+int NCO64(_set_frequency)(NCO64() _q,
+                          T       _dtheta)
+{
+    _q->d_theta = NCO64(_constrain)(_dtheta);
+    return LIQUID_OK;
+}
+
+// adjust frequency [radians/sample]
+int NCO64(_adjust_frequency)(NCO64() _q,
+                             T       _df)
+{
+    _q->d_theta += NCO64(_constrain)(_df);
+    return LIQUID_OK;
+}
+
+// get frequency [radians/sample] in [-pi, pi)
+T NCO64(_get_frequency)(NCO64() _q)
+{
+    return (T)(2*M_PI*(double)(int64_t)_q->d_theta / 18446744073709551616.0);
+}
+
+// set frequency word (2^64 corresponds to 2*pi radians/sample)
+int NCO64(_set_frequency_word)(NCO64()  _q,
+                               uint64_t _word)
+{
+    _q->d_theta = _word;
+    return LIQUID_OK;
+}
+
+// get frequency word
+uint64_t NCO64(_get_frequency_word)(NCO64() _q)
+{
+    return _q->d_theta;
+}
+
+// set phase [radians]
+int NCO64(_set_phase)(NCO64() _q,
+                      T       _phi)
+{
+    _q->theta = NCO64(_constrain)(_phi);
+    return LIQUID_OK;
+}
+
+// adjust phase [radians]
+int NCO64(_adjust_phase)(NCO64() _q,
+                         T       _dphi)
+{
+    _q->theta += NCO64(_constrain)(_dphi);
+    return LIQUID_OK;
+}
+
+// get phase [radians] in [0, 2*pi)
+T NCO64(_get_phase)(NCO64() _q)
+{
+    return (T)(2*M_PI*(double)_q->theta / 18446744073709551616.0);
+}
+
+// set phase word (2^64 corresponds to 2*pi radians)
+int NCO64(_set_phase_word)(NCO64()  _q,
+                           uint64_t _word)
+{
+    _q->theta = _word;
+    return LIQUID_OK;
+}
+
+// get phase word
+uint64_t NCO64(_get_phase_word)(NCO64() _q)
+{
+    return _q->theta;
+}
+
+// increment internal phase
+int NCO64(_step)(NCO64() _q)
+{
+    _q->theta += _q->d_theta;
+    return LIQUID_OK;
+}
+
+// compute sin, cos of internal phase
+int NCO64(_sincos)(NCO64() _q,
+                   T *     _s,
+                   T *     _c)
+{
+    const unsigned int shift = NCO_STATIC_LUT_WORDBITS - NCO_STATIC_LUT_NBITS;
+    const unsigned int mask  = NCO_STATIC_LUT_SIZE - 1;
+    uint32_t t = (uint32_t)(_q->theta >> 32);
+    T vsin, vcos;
+    if (_q->nco->type == LIQUID_NCO) {
+        NCO_SINCOS_NCO(_q->nco->nco_sintab, t, vsin, vcos);
+    } else {
+        NCO_SINCOS_VCOI(_q->nco->vcoi_sintab, t, vsin, vcos);
+    }
+    *_s = vsin;
+    *_c = vcos;
+    return LIQUID_OK;
+}
+
+// compute complex exponential of internal phase
+int NCO64(_cexpf)(NCO64() _q,
+                  TC *    _y)
+{
+    T vsin, vcos;
+    NCO64(_sincos)(_q, &vsin, &vcos);
+    *_y = vcos + _Complex_I*vsin;
+    return LIQUID_OK;
+}
+
+// rotate input sample up by nco angle (no stepping)
+int NCO64(_mix_up)(NCO64() _q,
+                   TC      _x,
+                   TC *    _y)
+{
+    TC v;
+    NCO64(_cexpf)(_q, &v);
+    *_y = _x * v;
+    return LIQUID_OK;
+}
+
+// rotate input sample down by nco angle (no stepping)
+int NCO64(_mix_down)(NCO64() _q,
+                     TC      _x,
+                     TC *    _y)
+{
+    TC v;
+    NCO64(_cexpf)(_q, &v);
+    *_y = _x * CONJ(v);
+    return LIQUID_OK;
+}
+
+// rotate input vector up by nco angle, stepping phase once per sample
+int NCO64(_mix_block_up)(NCO64()      _q,
+                         TC *         _x,
+                         TC *         _y,
+                         unsigned int _n)
+{
+    return NCO64(_mix_block)(_q, _x, _y, _n, 0);
+}
+
+// rotate input vector down by nco angle, stepping phase once per sample
+int NCO64(_mix_block_down)(NCO64()      _q,
+                           TC *         _x,
+                           TC *         _y,
+                           unsigned int _n)
+{
+    return NCO64(_mix_block)(_q, _x, _y, _n, 1);
+}
+
+// generate complex exponential, stepping phase once per sample
+int NCO64(_generate_block)(NCO64()      _q,
+                           TC *         _y,
+                           unsigned int _n)
+{
+    return NCO64(_mix_block)(_q, NULL, _y, _n, 0);
+}
+
+//
+// internal methods
+//
+
+// Convert phase (or frequency) to 64-bit fixed point, computed in double
+// precision so that the full resolution of T is retained.
+uint64_t NCO64(_constrain)(T _theta)
+{
+    double p = (double)_theta / (2*M_PI);
+    p -= floor(p);
+
+    // p is in [0,1) but may round to 2^64 when scaled
+    double w = p * 18446744073709551616.0;
+    return w >= 18446744073709551616.0 ? 0 : (uint64_t)w;
+}
+
+// Rotate input vector array by nco angle (or generate the complex
+// exponential when _x is NULL), stepping phase once per sample. The
+// phase of each sample is computed directly as theta + i*d_theta on the
+// 64-bit accumulator and evaluated with the same arithmetic as
+// NCO64(_sincos).
+int NCO64(_mix_block)(NCO64()      _q,
+                      TC *         _x,
+                      TC *         _y,
+                      unsigned int _n,
+                      int          _down)
+{
+    // operate on interleaved real/imaginary components
+    const T * x = (const T *) _x;
+    T *       y = (T *)       _y;
+    T sign = _down ? TIL(-1) : TIL(1);
+    const unsigned int shift = NCO_STATIC_LUT_WORDBITS - NCO_STATIC_LUT_NBITS;
+    const unsigned int mask  = NCO_STATIC_LUT_SIZE - 1;
+    uint64_t theta   = _q->theta;
+    uint64_t d_theta = _q->d_theta;
+    unsigned int i;
+
+    if (_q->nco->type == LIQUID_NCO) {
+        const T * tab = _q->nco->nco_sintab;
+        for (i=0; i<_n; i++) {
+            uint32_t t = (uint32_t)((theta + (uint64_t)i * d_theta) >> 32);
+            T vsin, vcos;
+            NCO_SINCOS_NCO(tab, t, vsin, vcos);
+            vsin *= sign;
+            NCO_MIX_BLOCK_OUTPUT(i, vsin, vcos);
+        }
+    } else {
+        const vco_tab_e * tab = _q->nco->vcoi_sintab;
+        for (i=0; i<_n; i++) {
+            uint32_t t = (uint32_t)((theta + (uint64_t)i * d_theta) >> 32);
+            T vsin, vcos;
+            NCO_SINCOS_VCOI(tab, t, vsin, vcos);
+            vsin *= sign;
+            NCO_MIX_BLOCK_OUTPUT(i, vsin, vcos);
+        }
+    }
+    _q->theta = theta + (uint64_t)_n * d_theta;
+    return LIQUID_OK;
+}
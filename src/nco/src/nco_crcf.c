@@ -27,6 +27,7 @@
 #include "liquid.internal.h"
 
 #define NCO(name)   LIQUID_CONCAT(nco_crcf,name)
+#define NCO64(name) LIQUID_CONCAT(nco64_crcf,name)
 #define SYNTH(name) LIQUID_CONCAT(synth_crcf,name)
 #define EXTENSION   "crcf"
 #define T           float
@@ -40,9 +41,11 @@
 #define COS         cosf
 #define CONJ        conjf
 #define SQRT        sqrtf
+#define ATAN2       atan2f
 #define LIQUID_PI   (3.14159265358979323846264338327950288f)
 
 // prototypes
 #include "nco.proto.c"
+#include "nco64.proto.c"
 #include "synth.proto.c"
 
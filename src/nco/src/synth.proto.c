@@ -226,6 +226,18 @@ void SYNTH(_mix_block_down)(SYNTH() _q, TC * _x, TC * _y, unsigned int _n)
     }
 }
 
+void SYNTH(_generate_block)(SYNTH() _q, TC * _y, unsigned int _n)
+{
+    unsigned int i;
+    for (i = 0; i < _n; i++) {
+        // store current complex exponential
+        _y[i] = _q->current;
+
+        // step SYNTH phase
+        SYNTH(_step)(_q);
+    }
+}
+
 void SYNTH(_spread)(SYNTH() _q, TC _x, TC * _y)
 {
     unsigned int i;
@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2007 - 2025 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <complex.h>
+#include "autotest/autotest.h"
+#include "liquid.h"
+
+// compare output against exact phase computed from the 64-bit words
+void testbench_nco64_crcf_sincos(int      _type,
+                                 uint64_t _theta,
+                                 uint64_t _d_theta,
+                                 float    _tol)
+{
+    nco64_crcf q = nco64_crcf_create(_type);
+    nco64_crcf_set_phase_word    (q, _theta);
+    nco64_crcf_set_frequency_word(q, _d_theta);
+
+    unsigned int i, num_samples = 2000;
+    for (i=0; i<num_samples; i++) {
+        uint64_t t     = _theta + (uint64_t)i * _d_theta;
+        double   phase = 2*M_PI * (double)t / 18446744073709551616.0;
+        float complex v;
+        nco64_crcf_cexpf(q, &v);
+        CONTEND_DELTA(crealf(v), cos(phase), _tol);
+        CONTEND_DELTA(cimagf(v), sin(phase), _tol);
+        nco64_crcf_step(q);
+    }
+    CONTEND_EQUALITY(nco64_crcf_get_phase_word(q), _theta + (uint64_t)num_samples * _d_theta);
+    nco64_crcf_destroy(q);
+}
+
+void autotest_nco64_crcf_sincos_nco_0() { testbench_nco64_crcf_sincos(LIQUID_NCO, 0,                     0x0123456789abcdefULL, 4e-3f); }
+void autotest_nco64_crcf_sincos_nco_1() { testbench_nco64_crcf_sincos(LIQUID_NCO, 0xfedcba9876543210ULL, 0xf000000000000001ULL, 4e-3f); }
+void autotest_nco64_crcf_sincos_vco_0() { testbench_nco64_crcf_sincos(LIQUID_VCO, 0,                     0x0123456789abcdefULL, 1e-4f); }
+void autotest_nco64_crcf_sincos_vco_1() { testbench_nco64_crcf_sincos(LIQUID_VCO, 0xfedcba9876543210ULL, 0xf000000000000001ULL, 1e-4f); }
+
+// compare block methods against one sample at a time
+void testbench_nco64_crcf_block(int _type,
+                                int _mode)
+{
+    unsigned int buf_len = 999;
+    nco64_crcf q0 = nco64_crcf_create(_type);
+    nco64_crcf_set_phase_word    (q0, 0x3c00000000000123ULL);
+    nco64_crcf_set_frequency_word(q0, 0xa987654321fedcbaULL);
+    nco64_crcf q1 = nco64_crcf_copy(q0);
+
+    float complex x[buf_len], y0[buf_len], y1[buf_len];
+    unsigned int i;
+    for (i=0; i<buf_len; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+
+    // per-sample reference
+    for (i=0; i<buf_len; i++) {
+        switch (_mode) {
+        case 0:  nco64_crcf_mix_up  (q0, x[i], &y0[i]); break;
+        case 1:  nco64_crcf_mix_down(q0, x[i], &y0[i]); break;
+        default: nco64_crcf_cexpf   (q0, &y0[i]);
+        }
+        nco64_crcf_step(q0);
+    }
+
+    // block method in uneven chunks, in place
+    memmove(y1, x, buf_len*sizeof(float complex));
+    unsigned int n[3] = {1, 500, buf_len - 501};
+    float complex * p = y1;
+    for (i=0; i<3; i++) {
+        switch (_mode) {
+        case 0:  nco64_crcf_mix_block_up  (q1, p, p, n[i]); break;
+        case 1:  nco64_crcf_mix_block_down(q1, p, p, n[i]); break;
+        default: nco64_crcf_generate_block(q1, p,    n[i]);
+        }
+        p += n[i];
+    }
+
+    // outputs and final phase should match
+    for (i=0; i<buf_len; i++) {
+        CONTEND_DELTA(crealf(y1[i]), crealf(y0[i]), 1e-6f);
+        CONTEND_DELTA(cimagf(y1[i]), cimagf(y0[i]), 1e-6f);
+    }
+    CONTEND_EQUALITY(nco64_crcf_get_phase_word(q0), nco64_crcf_get_phase_word(q1));
+
+    nco64_crcf_destroy(q0);
+    nco64_crcf_destroy(q1);
+}
+
+void autotest_nco64_crcf_mix_block_up_nco()   { testbench_nco64_crcf_block(LIQUID_NCO, 0); }
+void autotest_nco64_crcf_mix_block_down_nco() { testbench_nco64_crcf_block(LIQUID_NCO, 1); }
+void autotest_nco64_crcf_generate_block_nco() { testbench_nco64_crcf_block(LIQUID_NCO, 2); }
+void autotest_nco64_crcf_mix_block_up_vco()   { testbench_nco64_crcf_block(LIQUID_VCO, 0); }
+void autotest_nco64_crcf_mix_block_down_vco() { testbench_nco64_crcf_block(LIQUID_VCO, 1); }
+void autotest_nco64_crcf_generate_block_vco() { testbench_nco64_crcf_block(LIQUID_VCO, 2); }
+
+// phase should accumulate exactly over long runs
+void autotest_nco64_crcf_long_run()
+{
+    uint64_t d_theta = 0x000001234567890bULL;
+    nco64_crcf q = nco64_crcf_create(LIQUID_NCO);
+    nco64_crcf_set_frequency_word(q, d_theta);
+
+    unsigned int i, buf_len = 4096, num_blocks = 1000;
+    float complex buf[buf_len];
+    for (i=0; i<num_blocks; i++)
+        nco64_crcf_generate_block(q, buf, buf_len);
+    CONTEND_EQUALITY(nco64_crcf_get_phase_word(q), (uint64_t)buf_len * num_blocks * d_theta);
+    nco64_crcf_destroy(q);
+}
+
+// frequency and phase in radians
+void autotest_nco64_crcf_frequency_phase()
+{
+    nco64_crcf q = nco64_crcf_create(LIQUID_VCO);
+    nco64_crcf_set_frequency(q, -0.123456f);
+    nco64_crcf_set_phase    (q,  2.5f);
+    CONTEND_DELTA(nco64_crcf_get_frequency(q), -0.123456f, 1e-6f);
+    CONTEND_DELTA(nco64_crcf_get_phase    (q),  2.5f,      1e-6f);
+
+    nco64_crcf_adjust_frequency(q,  0.2f);
+    nco64_crcf_adjust_phase    (q, -3.0f);
+    CONTEND_DELTA(nco64_crcf_get_frequency(q), 0.076544f,             1e-6f);
+    CONTEND_DELTA(nco64_crcf_get_phase    (q), 2*M_PI - 0.5f,         1e-5f);
+
+    nco64_crcf_step(q);
+    CONTEND_DELTA(nco64_crcf_get_phase    (q), 2*M_PI - 0.5f + 0.076544f, 1e-5f);
+
+    nco64_crcf_reset(q);
+    CONTEND_EQUALITY(nco64_crcf_get_frequency_word(q), 0);
+    CONTEND_EQUALITY(nco64_crcf_get_phase_word    (q), 0);
+    nco64_crcf_destroy(q);
+}
+
+void autotest_nco64_crcf_config()
+{
+#if LIQUID_STRICT_EXIT
+    AUTOTEST_WARN("skipping nco64 config test with strict exit enabled\n");
+    return;
+#endif
+#if !LIQUID_SUPPRESS_ERROR_OUTPUT
+    fprintf(stderr,"warning: ignore potential errors here; checking for invalid configurations\n");
+#endif
+    CONTEND_ISNULL(nco64_crcf_create(LIQUID_VCO_DIRECT));
+    CONTEND_INEQUALITY(LIQUID_OK, nco64_crcf_destroy(NULL));
+    CONTEND_ISNULL(nco64_crcf_copy(NULL));
+
+    nco64_crcf q = nco64_crcf_create(LIQUID_NCO);
+    CONTEND_EQUALITY(LIQUID_OK, nco64_crcf_print(q));
+    nco64_crcf_destroy(q);
+}
@@ -21,6 +21,7 @@
  */
 
 #include <stdlib.h>
+#include <string.h>
 #include <complex.h>
 #include "autotest/autotest.h"
 #include "liquid.h"
@@ -89,3 +90,204 @@ void autotest_nco_crcf_mix_vco_7() { testbench_nco_crcf_mix(LIQUID_VCO,  0.000f,
 void autotest_nco_crcf_mix_vco_8() { testbench_nco_crcf_mix(LIQUID_VCO,  0.000f, -0.123f); }
 void autotest_nco_crcf_mix_vco_9() { testbench_nco_crcf_mix(LIQUID_VCO,  0.000f,  1e-5f ); }
 
+
+// compare block mixing against mixing one sample at a time
+void testbench_nco_crcf_mix_block(int _type,
+                                  int _down)
+{
+    unsigned int buf_len = 999;
+    nco_crcf q0 = nco_crcf_create(_type);
+    nco_crcf q1 = nco_crcf_create(_type);
+    if (_type == LIQUID_VCO_DIRECT) {
+        nco_crcf_set_vcodirect_frequency(q0, 7, 113);
+        nco_crcf_set_vcodirect_frequency(q1, 7, 113);
+    } else {
+        nco_crcf_set_phase    (q0, 2.1f);
+        nco_crcf_set_phase    (q1, 2.1f);
+        nco_crcf_set_frequency(q0, -0.4567f);
+        nco_crcf_set_frequency(q1, -0.4567f);
+    }
+
+    float complex x[buf_len], y0[buf_len], y1[buf_len];
+    unsigned int i;
+    for (i=0; i<buf_len; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+
+    // per-sample reference
+    for (i=0; i<buf_len; i++) {
+        if (_down) nco_crcf_mix_down(q0, x[i], &y0[i]);
+        else       nco_crcf_mix_up  (q0, x[i], &y0[i]);
+        nco_crcf_step(q0);
+    }
+
+    // block method in uneven chunks, the last one in place
+    memmove(y1, x, buf_len*sizeof(float complex));
+    unsigned int n[3] = {1, 500, buf_len - 501};
+    float complex * p = y1;
+    for (i=0; i<3; i++) {
+        if (_down) nco_crcf_mix_block_down(q1, p, p, n[i]);
+        else       nco_crcf_mix_block_up  (q1, p, p, n[i]);
+        p += n[i];
+    }
+
+    // outputs and final phase should match
+    for (i=0; i<buf_len; i++) {
+        CONTEND_DELTA(crealf(y1[i]), crealf(y0[i]), 1e-6f);
+        CONTEND_DELTA(cimagf(y1[i]), cimagf(y0[i]), 1e-6f);
+    }
+    float complex v0, v1;
+    nco_crcf_cexpf(q0, &v0);
+    nco_crcf_cexpf(q1, &v1);
+    CONTEND_EQUALITY(v0, v1);
+
+    nco_crcf_destroy(q0);
+    nco_crcf_destroy(q1);
+}
+
+void autotest_nco_crcf_mix_block_up_nco()    { testbench_nco_crcf_mix_block(LIQUID_NCO,        0); }
+void autotest_nco_crcf_mix_block_down_nco()  { testbench_nco_crcf_mix_block(LIQUID_NCO,        1); }
+void autotest_nco_crcf_mix_block_up_vco()    { testbench_nco_crcf_mix_block(LIQUID_VCO,        0); }
+void autotest_nco_crcf_mix_block_down_vco()  { testbench_nco_crcf_mix_block(LIQUID_VCO,        1); }
+void autotest_nco_crcf_mix_block_up_vcod()   { testbench_nco_crcf_mix_block(LIQUID_VCO_DIRECT, 0); }
+void autotest_nco_crcf_mix_block_down_vcod() { testbench_nco_crcf_mix_block(LIQUID_VCO_DIRECT, 1); }
+
+// compare block generation against computing one sample at a time
+void testbench_nco_crcf_generate_block(int _type)
+{
+    unsigned int buf_len = 999;
+    nco_crcf q0 = nco_crcf_create(_type);
+    nco_crcf q1 = nco_crcf_create(_type);
+    if (_type == LIQUID_VCO_DIRECT) {
+        nco_crcf_set_vcodirect_frequency(q0, -5, 97);
+        nco_crcf_set_vcodirect_frequency(q1, -5, 97);
+    } else {
+        nco_crcf_set_phase    (q0, -0.7f);
+        nco_crcf_set_phase    (q1, -0.7f);
+        nco_crcf_set_frequency(q0, 0.2345f);
+        nco_crcf_set_frequency(q1, 0.2345f);
+    }
+
+    // per-sample reference
+    float complex y0[buf_len], y1[buf_len];
+    unsigned int i;
+    for (i=0; i<buf_len; i++) {
+        nco_crcf_cexpf(q0, &y0[i]);
+        nco_crcf_step(q0);
+    }
+
+    // block method in uneven chunks
+    unsigned int n[3] = {1, 500, buf_len - 501};
+    float complex * p = y1;
+    for (i=0; i<3; i++) {
+        CONTEND_EQUALITY(nco_crcf_generate_block(q1, p, n[i]), LIQUID_OK);
+        p += n[i];
+    }
+
+    // outputs and final phase should match
+    for (i=0; i<buf_len; i++) {
+        CONTEND_DELTA(crealf(y1[i]), crealf(y0[i]), 1e-6f);
+        CONTEND_DELTA(cimagf(y1[i]), cimagf(y0[i]), 1e-6f);
+    }
+    float complex v0, v1;
+    nco_crcf_cexpf(q0, &v0);
+    nco_crcf_cexpf(q1, &v1);
+    CONTEND_EQUALITY(v0, v1);
+
+    nco_crcf_destroy(q0);
+    nco_crcf_destroy(q1);
+}
+
+void autotest_nco_crcf_generate_block_nco()  { testbench_nco_crcf_generate_block(LIQUID_NCO       ); }
+void autotest_nco_crcf_generate_block_vco()  { testbench_nco_crcf_generate_block(LIQUID_VCO       ); }
+void autotest_nco_crcf_generate_block_vcod() { testbench_nco_crcf_generate_block(LIQUID_VCO_DIRECT); }
+
+// compare chirp generation against adjusting frequency after each sample
+void testbench_nco_crcf_generate_chirp_block(int   _type,
+                                             float _df)
+{
+    unsigned int buf_len = 2000;
+    nco_crcf q0 = nco_crcf_create(_type);
+    nco_crcf q1 = nco_crcf_create(_type);
+    nco_crcf_set_phase    (q0, 1.3f);
+    nco_crcf_set_phase    (q1, 1.3f);
+    nco_crcf_set_frequency(q0, -0.8f);
+    nco_crcf_set_frequency(q1, -0.8f);
+
+    // per-sample reference
+    float complex y0[buf_len], y1[buf_len];
+    unsigned int i;
+    for (i=0; i<buf_len; i++) {
+        nco_crcf_cexpf(q0, &y0[i]);
+        nco_crcf_step(q0);
+        nco_crcf_adjust_frequency(q0, _df);
+    }
+
+    // block method in uneven chunks
+    unsigned int n[3] = {1, 1200, buf_len - 1201};
+    float complex * p = y1;
+    for (i=0; i<3; i++) {
+        CONTEND_EQUALITY(nco_crcf_generate_chirp_block(q1, p, n[i], _df), LIQUID_OK);
+        p += n[i];
+    }
+
+    // outputs, final phase, and final frequency should match exactly
+    for (i=0; i<buf_len; i++) {
+        CONTEND_DELTA(crealf(y1[i]), crealf(y0[i]), 1e-6f);
+        CONTEND_DELTA(cimagf(y1[i]), cimagf(y0[i]), 1e-6f);
+    }
+    CONTEND_EQUALITY(nco_crcf_get_phase    (q0), nco_crcf_get_phase    (q1));
+    CONTEND_EQUALITY(nco_crcf_get_frequency(q0), nco_crcf_get_frequency(q1));
+
+    nco_crcf_destroy(q0);
+    nco_crcf_destroy(q1);
+}
+
+void autotest_nco_crcf_generate_chirp_block_nco_0() { testbench_nco_crcf_generate_chirp_block(LIQUID_NCO,  1e-3f); }
+void autotest_nco_crcf_generate_chirp_block_nco_1() { testbench_nco_crcf_generate_chirp_block(LIQUID_NCO, -7e-4f); }
+void autotest_nco_crcf_generate_chirp_block_vco_0() { testbench_nco_crcf_generate_chirp_block(LIQUID_VCO,  1e-3f); }
+void autotest_nco_crcf_generate_chirp_block_vco_1() { testbench_nco_crcf_generate_chirp_block(LIQUID_VCO, -7e-4f); }
+
+void autotest_nco_crcf_generate_chirp_block_config()
+{
+#if LIQUID_STRICT_EXIT
+    AUTOTEST_WARN("skipping nco_crcf_generate_chirp_block config test with strict exit enabled\n");
+    return;
+#endif
+#if !LIQUID_SUPPRESS_ERROR_OUTPUT
+    fprintf(stderr,"warning: ignore potential errors here; checking for invalid configurations\n");
+#endif
+    // chirp is not supported for direct VCO
+    float complex y[4];
+    nco_crcf q = nco_crcf_create(LIQUID_VCO_DIRECT);
+    CONTEND_INEQUALITY(nco_crcf_generate_chirp_block(q, y, 4, 0.01f), LIQUID_OK);
+    nco_crcf_destroy(q);
+}
+
+// compare synthesizer block generation against one sample at a time
+void autotest_synth_crcf_generate_block()
+{
+    unsigned int buf_len = 300;
+    float complex table[64];
+    unsigned int i;
+    for (i=0; i<64; i++)
+        table[i] = (i*37 % 5) < 2 ? 1.0f : -1.0f;
+    synth_crcf q0 = synth_crcf_create(table, 64);
+    synth_crcf q1 = synth_crcf_create(table, 64);
+    synth_crcf_set_frequency(q0, 0.0731f);
+    synth_crcf_set_frequency(q1, 0.0731f);
+
+    float complex y0[buf_len], y1[buf_len];
+    for (i=0; i<buf_len; i++) {
+        y0[i] = synth_crcf_get_current(q0);
+        synth_crcf_step(q0);
+    }
+    synth_crcf_generate_block(q1, y1,       100);
+    synth_crcf_generate_block(q1, y1 + 100, buf_len - 100);
+
+    for (i=0; i<buf_len; i++)
+        CONTEND_EQUALITY(y1[i], y0[i]);
+    CONTEND_EQUALITY(synth_crcf_get_current(q0), synth_crcf_get_current(q1));
+
+    synth_crcf_destroy(q0);
+    synth_crcf_destroy(q1);
+}
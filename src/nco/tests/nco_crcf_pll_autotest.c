@@ -20,6 +20,7 @@
  * THE SOFTWARE.
  */
 
+#include <math.h>
 #include <complex.h>
 #include "autotest/autotest.h"
 #include "liquid.h"
@@ -140,3 +141,98 @@ void autotest_nco_crcf_pll_freq()
     }
 }
 
+
+// compute phase error of mixed sample for block pll reference
+float testbench_nco_crcf_pll_detect(float complex _y, liquid_pll_detector _detector)
+{
+    float yr = crealf(_y), yi = cimagf(_y);
+    switch (_detector) {
+    case LIQUID_PLL_DETECTOR_COSTAS_BPSK: return yr > 0 ? yi : -yi;
+    case LIQUID_PLL_DETECTOR_COSTAS_QPSK: return (yr > 0 ? yi : -yi) - (yi > 0 ? yr : -yr);
+    default:;
+    }
+    return atan2f(yi, yr);
+}
+
+// compare block pll against running one sample at a time
+void testbench_nco_crcf_pll_block(int                 _type,
+                                  liquid_pll_detector _detector)
+{
+    unsigned int buf_len = 1200;
+    nco_crcf q0 = nco_crcf_create(_type);
+    nco_crcf_pll_set_bandwidth(q0, 0.02f);
+    nco_crcf_set_frequency    (q0, 0.01f);
+    nco_crcf q1 = nco_crcf_copy(q0);
+
+    // input with phase and frequency offset, modulated by detector type
+    float complex x[buf_len], y0[buf_len], y1[buf_len];
+    unsigned int i;
+    for (i=0; i<buf_len; i++) {
+        float complex s = 1.0f;
+        if (_detector == LIQUID_PLL_DETECTOR_COSTAS_BPSK)
+            s = (i*7 % 5) < 2 ? 1.0f : -1.0f;
+        else if (_detector == LIQUID_PLL_DETECTOR_COSTAS_QPSK)
+            s = cexpf(_Complex_I*(M_PI/4 + M_PI/2*(i*7 % 11 % 4)));
+        x[i] = s * cexpf(_Complex_I*(0.4f + 0.03f*i));
+    }
+
+    // per-sample reference
+    for (i=0; i<buf_len; i++) {
+        nco_crcf_mix_down(q0, x[i], &y0[i]);
+        nco_crcf_pll_step(q0, testbench_nco_crcf_pll_detect(y0[i], _detector));
+        nco_crcf_step(q0);
+    }
+
+    // block method in uneven chunks
+    unsigned int n[3] = {1, 700, buf_len - 701};
+    float complex * p = x, * r = y1;
+    for (i=0; i<3; i++) {
+        CONTEND_EQUALITY(nco_crcf_pll_execute_block(q1, p, r, n[i], _detector), LIQUID_OK);
+        p += n[i];
+        r += n[i];
+    }
+
+    // outputs, phase, and frequency should match (to within rounding, as the
+    // compiler may contract multiply-adds differently in the two paths)
+    float tol = 1e-4f;
+    for (i=0; i<buf_len; i++) {
+        CONTEND_DELTA(crealf(y1[i]), crealf(y0[i]), tol);
+        CONTEND_DELTA(cimagf(y1[i]), cimagf(y0[i]), tol);
+    }
+    float phase_error = nco_crcf_get_phase(q1) - nco_crcf_get_phase(q0);
+    CONTEND_DELTA(fmodf(phase_error + 3*M_PI, 2*M_PI) - M_PI, 0.0f, tol);
+    CONTEND_DELTA(nco_crcf_get_frequency(q1), nco_crcf_get_frequency(q0), tol);
+
+    // loop should be locked to frequency offset
+    CONTEND_DELTA(nco_crcf_get_frequency(q1), 0.03f, 1e-3f);
+    CONTEND_DELTA(testbench_nco_crcf_pll_detect(y1[buf_len-1], _detector), 0.0f, 1e-2f);
+
+    nco_crcf_destroy(q0);
+    nco_crcf_destroy(q1);
+}
+
+void autotest_nco_crcf_pll_block_nco_carrier() { testbench_nco_crcf_pll_block(LIQUID_NCO, LIQUID_PLL_DETECTOR_CARRIER    ); }
+void autotest_nco_crcf_pll_block_nco_bpsk()    { testbench_nco_crcf_pll_block(LIQUID_NCO, LIQUID_PLL_DETECTOR_COSTAS_BPSK); }
+void autotest_nco_crcf_pll_block_nco_qpsk()    { testbench_nco_crcf_pll_block(LIQUID_NCO, LIQUID_PLL_DETECTOR_COSTAS_QPSK); }
+void autotest_nco_crcf_pll_block_vco_carrier() { testbench_nco_crcf_pll_block(LIQUID_VCO, LIQUID_PLL_DETECTOR_CARRIER    ); }
+void autotest_nco_crcf_pll_block_vco_bpsk()    { testbench_nco_crcf_pll_block(LIQUID_VCO, LIQUID_PLL_DETECTOR_COSTAS_BPSK); }
+void autotest_nco_crcf_pll_block_vco_qpsk()    { testbench_nco_crcf_pll_block(LIQUID_VCO, LIQUID_PLL_DETECTOR_COSTAS_QPSK); }
+
+void autotest_nco_crcf_pll_block_config()
+{
+#if LIQUID_STRICT_EXIT
+    AUTOTEST_WARN("skipping nco_crcf_pll_execute_block config test with strict exit enabled\n");
+    return;
+#endif
+#if !LIQUID_SUPPRESS_ERROR_OUTPUT
+    fprintf(stderr,"warning: ignore potential errors here; checking for invalid configurations\n");
+#endif
+    float complex x[4] = {1, 1, 1, 1}, y[4];
+    nco_crcf q = nco_crcf_create(LIQUID_VCO_DIRECT);
+    CONTEND_INEQUALITY(nco_crcf_pll_execute_block(q, x, y, 4, LIQUID_PLL_DETECTOR_CARRIER), LIQUID_OK);
+    nco_crcf_destroy(q);
+
+    q = nco_crcf_create(LIQUID_NCO);
+    CONTEND_INEQUALITY(nco_crcf_pll_execute_block(q, x, y, 4, (liquid_pll_detector)99), LIQUID_OK);
+    nco_crcf_destroy(q);
+}
@@ -30,8 +30,9 @@
 
 #include "liquid.internal.h"
 
-// Exponential
-float randexpf(float _lambda)
+// Exponential, drawn from generator _q or from rand() when _q is NULL
+static float randexpf_rng(liquid_rng _q,
+                          float      _lambda)
 {
     // validate input
     if (_lambda <= 0) {
@@ -42,13 +43,26 @@ float randexpf(float _lambda)
     // compute a non-zero uniform random variable in (0,1]
     float u;
     do {
-        u = randf();
+        u = LIQUID_RNG_RANDF(_q);
     } while (u==0.0f);
 
     // perform variable transformation
     return -logf( u ) / _lambda;
 }
 
+// Exponential
+float randexpf(float _lambda)
+{
+    return randexpf_rng(NULL, _lambda);
+}
+
+// Exponential from generator _q
+float liquid_rng_randexpf(liquid_rng _q,
+                          float      _lambda)
+{
+    return randexpf_rng(_q == NULL ? liquid_rng_default() : _q, _lambda);
+}
+
 // Exponential random number probability distribution function
 float randexpf_pdf(float _x,
                    float _lambda)
@@ -33,33 +33,15 @@
 float randgammaf(float _alpha,
                  float _beta)
 {
-    // validate input
-    if (_alpha <= 0.0f) {
-        liquid_error(LIQUID_EICONFIG,"randgammaf(), alpha must be greater than zero");
-        return 0.0f;
-    } else if (_beta <= 0.0f) {
-        liquid_error(LIQUID_EICONFIG,"randgammaf(), beta must be greater than zero");
-        return 0.0f;
-    }
-
-    unsigned int n = (unsigned int) floorf(_alpha);
-
-    // residual
-    float delta = _alpha - (float)n;
-
-    // generate x' ~ Gamma(n,1)
-    float x_n = 0.0f;
-    unsigned int i;
-    for (i=0; i<n; i++) {
-        float u = randf();
-        x_n += - logf(u);
-    }
-
-    // generate x'' ~ Gamma(delta,1) using rejection method
-    float x_delta = randgammaf_delta(delta);
+    return randgammaf_rng(NULL, _alpha, _beta);
+}
 
-    // 
-    return _beta * (x_delta + x_n);
+// Gamma from generator _q
+float liquid_rng_randgammaf(liquid_rng _q,
+                            float      _alpha,
+                            float      _beta)
+{
+    return randgammaf_rng(_q == NULL ? liquid_rng_default() : _q, _alpha, _beta);
 }
 
 // Gamma distribution cumulative distribution function
@@ -127,8 +109,51 @@ float randgammaf_cdf(float _x,
 // internal methods
 //
 
+// generate x ~ Gamma(alpha,beta) from generator _q, or from rand() when
+// _q is NULL
+float randgammaf_rng(liquid_rng _q,
+                     float      _alpha,
+                     float      _beta)
+{
+    // validate input
+    if (_alpha <= 0.0f) {
+        liquid_error(LIQUID_EICONFIG,"randgammaf(), alpha must be greater than zero");
+        return 0.0f;
+    } else if (_beta <= 0.0f) {
+        liquid_error(LIQUID_EICONFIG,"randgammaf(), beta must be greater than zero");
+        return 0.0f;
+    }
+
+    unsigned int n = (unsigned int) floorf(_alpha);
+
+    // residual
+    float delta = _alpha - (float)n;
+
+    // generate x' ~ Gamma(n,1)
+    float x_n = 0.0f;
+    unsigned int i;
+    for (i=0; i<n; i++) {
+        float u = LIQUID_RNG_RANDF(_q);
+        x_n += - logf(u);
+    }
+
+    // generate x'' ~ Gamma(delta,1) using rejection method
+    float x_delta = randgammaf_delta_rng(_q, delta);
+
+    // 
+    return _beta * (x_delta + x_n);
+}
+
 // generate x ~ Gamma(delta,1)
 float randgammaf_delta(float _delta)
+{
+    return randgammaf_delta_rng(NULL, _delta);
+}
+
+// generate x ~ Gamma(delta,1) from generator _q, or from rand() when _q
+// is NULL
+float randgammaf_delta_rng(liquid_rng _q,
+                           float      _delta)
 {
     // validate input
     if ( _delta < 0.0f || _delta >= 1.0f ) {
@@ -152,9 +177,9 @@ float randgammaf_delta(float _delta)
 
     while (1) {
         // step 2
-        V0 = randf();
-        V1 = randf();
-        V2 = randf();
+        V0 = LIQUID_RNG_RANDF(_q);
+        V1 = LIQUID_RNG_RANDF(_q);
+        V2 = LIQUID_RNG_RANDF(_q);
 
         if (V2 <= v0) {
             // step 4
@@ -81,6 +81,24 @@ void cawgn(float complex *_x, float _nstd)
     *_x += icrandnf()*_nstd*0.707106781186547f;
 }
 
+// block of Gauss random numbers from the calling thread's liquid_rng
+int randnf_block(float * _y, unsigned int _n)
+{
+    return liquid_rng_randnf_block(NULL, _y, _n);
+}
+
+// block of complex Gauss random numbers
+int crandnf_block(float complex * _y, unsigned int _n)
+{
+    return liquid_rng_crandnf_block(NULL, _y, _n);
+}
+
+// add complex Gauss noise to block
+int cawgn_block(float complex * _x, unsigned int _n, float _nstd)
+{
+    return liquid_rng_cawgn_block(NULL, _x, _n, _nstd);
+}
+
 // Gauss random number probability distribution function
 float randnf_pdf(float _x,
                  float _eta,
@@ -30,8 +30,10 @@
 
 #include "liquid.internal.h"
 
-float randnakmf(float _m,
-                float _omega)
+// Nakagami-m, drawn from generator _q or from rand() when _q is NULL
+static float randnakmf_rng(liquid_rng _q,
+                           float      _m,
+                           float      _omega)
 {
     // validate input
     if (_m < 0.5f) {
@@ -45,12 +47,26 @@ float randnakmf(float _m,
     // generate Gamma random variable
     float alpha = _m;
     float beta  = _omega / _m;
-    float x = randgammaf(alpha,beta);
+    float x = randgammaf_rng(_q,alpha,beta);
 
     // sqrt(x) ~ Nakagami(m,omega)
     return sqrtf(x);
 }
 
+float randnakmf(float _m,
+                float _omega)
+{
+    return randnakmf_rng(NULL, _m, _omega);
+}
+
+// Nakagami-m from generator _q
+float liquid_rng_randnakmf(liquid_rng _q,
+                           float      _m,
+                           float      _omega)
+{
+    return randnakmf_rng(_q == NULL ? liquid_rng_default() : _q, _m, _omega);
+}
+
 // Nakagami-m distribution probability distribution function
 // Nakagami-m
 //  f(x) = (2/Gamma(m)) (m/omega)^m x^(2m-1) exp{-(m/omega)x^2}
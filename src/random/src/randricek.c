@@ -30,18 +30,34 @@
 
 #include "liquid.internal.h"
 
-// Rice-K
-float randricekf(float _K, float _omega)
+// Rice-K, drawn from generator _q or from rand() when _q is NULL
+static float randricekf_rng(liquid_rng _q,
+                            float      _K,
+                            float      _omega)
 {
     float complex x, y;
     float s = sqrtf((_omega*_K)/(_K+1));
     float sig = sqrtf(0.5f*_omega/(_K+1));
-    crandnf(&x);
+    LIQUID_RNG_CRANDNF(_q, &x);
     y = _Complex_I*( crealf(x)*sig + s ) +
                    ( cimagf(x)*sig     );
     return cabsf(y);
 }
 
+// Rice-K
+float randricekf(float _K, float _omega)
+{
+    return randricekf_rng(NULL, _K, _omega);
+}
+
+// Rice-K from generator _q
+float liquid_rng_randricekf(liquid_rng _q,
+                            float      _K,
+                            float      _omega)
+{
+    return randricekf_rng(_q == NULL ? liquid_rng_default() : _q, _K, _omega);
+}
+
 
 // Rice-K random number probability distribution function
 //  f(x) = (x/sigma^2) exp{ -(x^2+s^2)/(2sigma^2) } I0( x s / sigma^2 )
@@ -30,10 +30,11 @@
 
 #include "liquid.internal.h"
 
-// Weibull
-float randweibf(float _alpha,
-                float _beta,
-                float _gamma)
+// Weibull, drawn from generator _q or from rand() when _q is NULL
+static float randweibf_rng(liquid_rng _q,
+                           float      _alpha,
+                           float      _beta,
+                           float      _gamma)
 {
     // validate input
     if (_alpha <= 0) {
@@ -46,12 +47,29 @@ float randweibf(float _alpha,
 
     float u;
     do {
-        u = randf();
+        u = LIQUID_RNG_RANDF(_q);
     } while (u==0.0f);
 
     return _gamma + _beta*powf( -logf(u), 1.0f/_alpha );
 }
 
+// Weibull
+float randweibf(float _alpha,
+                float _beta,
+                float _gamma)
+{
+    return randweibf_rng(NULL, _alpha, _beta, _gamma);
+}
+
+// Weibull from generator _q
+float liquid_rng_randweibf(liquid_rng _q,
+                           float      _alpha,
+                           float      _beta,
+                           float      _gamma)
+{
+    return randweibf_rng(_q == NULL ? liquid_rng_default() : _q, _alpha, _beta, _gamma);
+}
+
 // Weibull random number probability distribution function
 float randweibf_pdf(float _x,
                     float _alpha,
@@ -0,0 +1,523 @@
+/*
+ * Copyright (c) 2007 - 2025 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// Per-object pseudo-random number generator
+//
+// xoshiro256** with splitmix64 seeding. Each object holds its own state
+// so that independent threads can draw numbers without contending on the
+// lock inside rand(). Passing a NULL object uses a default state local to
+// the calling thread.
+//
+// Counter-based generators (Philox4x32-10, Salmon et al., 2011) instead
+// compute each output directly from a key and a 128-bit counter, so a
+// (seed, stream, offset) triple addresses any point of any stream
+// without generating the values before it. This allows a simulation
+// split across workers to reproduce the same numbers regardless of
+// scheduling.
+//
+// Block methods draw Gauss variables with the ziggurat method (Marsaglia
+// and Tsang, 2000) which avoids transcendental functions for all but about
+// 1% of samples, using separate bits of each 64-bit draw for the layer
+// index and the value.
+//
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "liquid.internal.h"
+
+#define LIQUID_RNG_DEFAULT_SEED (0x6c69717569642d31ULL)
+
+struct liquid_rng_s {
+    // xoshiro256** state
+    uint64_t s[4];
+
+    // counter-based (Philox4x32-10) state
+    int      counter_based; // generator is counter-based
+    uint64_t seed;          // key
+    uint64_t stream;        // upper half of counter
+    uint64_t offset;        // index of next 64-bit output within stream
+    uint64_t buf[2];        // outputs of block containing offset (odd offset)
+};
+
+// default state for the calling thread, seeded on first use
+static LIQUID_THREAD_LOCAL struct liquid_rng_s liquid_rng_thread_state;
+static LIQUID_THREAD_LOCAL int                 liquid_rng_thread_init = 0;
+
+// counter giving each thread's default state a distinct seed
+static char         liquid_rng_thread_lock    = 0;
+static unsigned int liquid_rng_thread_counter = 0;
+
+// ziggurat tables for N(0,1), computed once on first use
+#define LIQUID_RNG_ZIG_LAYERS (128)
+static float        liquid_rng_zig_w[LIQUID_RNG_ZIG_LAYERS];   // layer width / 2^31
+static float        liquid_rng_zig_f[LIQUID_RNG_ZIG_LAYERS];   // pdf at layer edge
+static uint32_t     liquid_rng_zig_k[LIQUID_RNG_ZIG_LAYERS];   // fast acceptance bound
+static char         liquid_rng_zig_lock = 0;
+static unsigned int liquid_rng_zig_init = 0;
+
+// advance splitmix64 state and return next output
+static uint64_t liquid_rng_splitmix64(uint64_t * _x)
+{
+    uint64_t z = (*_x += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+#define liquid_rng_rotl(_x,_k) (((_x) << (_k)) | ((_x) >> (64 - (_k))))
+
+// compute Philox4x32-10 block of two 64-bit outputs for a 64-bit key
+// and 128-bit counter
+static void liquid_rng_philox(uint64_t   _key,
+                              uint64_t   _ctr_hi,
+                              uint64_t   _ctr_lo,
+                              uint64_t * _y)
+{
+    uint32_t c0 = (uint32_t)_ctr_lo, c1 = (uint32_t)(_ctr_lo >> 32);
+    uint32_t c2 = (uint32_t)_ctr_hi, c3 = (uint32_t)(_ctr_hi >> 32);
+    uint32_t k0 = (uint32_t)_key,    k1 = (uint32_t)(_key    >> 32);
+    unsigned int i;
+    for (i=0; i<10; i++) {
+        uint64_t p0 = (uint64_t)0xd2511f53 * c0;
+        uint64_t p1 = (uint64_t)0xcd9e8d57 * c2;
+        c0 = (uint32_t)(p1 >> 32) ^ c1 ^ k0;
+        c2 = (uint32_t)(p0 >> 32) ^ c3 ^ k1;
+        c1 = (uint32_t)p1;
+        c3 = (uint32_t)p0;
+        k0 += 0x9e3779b9;
+        k1 += 0xbb67ae85;
+    }
+    _y[0] = ((uint64_t)c1 << 32) | c0;
+    _y[1] = ((uint64_t)c3 << 32) | c2;
+}
+
+// next output of counter-based generator; each counter value gives two
+// outputs, the second of which is kept for the following call
+static uint64_t liquid_rng_next_counter(liquid_rng _q)
+{
+    uint64_t r;
+    if (_q->offset & 1) {
+        r = _q->buf[1];
+    } else {
+        liquid_rng_philox(_q->seed, _q->stream, _q->offset >> 1, _q->buf);
+        r = _q->buf[0];
+    }
+    _q->offset++;
+    return r;
+}
+
+// advance generator state and return next output
+static uint64_t liquid_rng_next(liquid_rng _q)
+{
+    if (_q->counter_based)
+        return liquid_rng_next_counter(_q);
+
+    uint64_t * s = _q->s;
+    uint64_t r = liquid_rng_rotl(s[1] * 5, 7) * 9;
+    uint64_t t = s[1] << 17;
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3]  = liquid_rng_rotl(s[3], 45);
+    return r;
+}
+
+// resolve object, using the calling thread's default state for NULL
+static liquid_rng liquid_rng_resolve(liquid_rng _q)
+{
+    if (_q != NULL)
+        return _q;
+    if (!liquid_rng_thread_init) {
+        liquid_spinlock_acquire(&liquid_rng_thread_lock);
+        unsigned int n = liquid_rng_thread_counter++;
+        liquid_spinlock_release(&liquid_rng_thread_lock);
+        liquid_rng_seed(&liquid_rng_thread_state,
+                        LIQUID_RNG_DEFAULT_SEED + 0x9e3779b97f4a7c15ULL*n);
+        liquid_rng_thread_init = 1;
+    }
+    return &liquid_rng_thread_state;
+}
+
+// create generator with seed
+liquid_rng liquid_rng_create(uint64_t _seed)
+{
+    liquid_rng q = (liquid_rng) malloc(sizeof(struct liquid_rng_s));
+    memset(q, 0, sizeof(struct liquid_rng_s));
+    liquid_rng_seed(q, _seed);
+    return q;
+}
+
+// create counter-based generator with seed (key) and stream, starting
+// at offset zero
+liquid_rng liquid_rng_create_counter(uint64_t _seed,
+                                     uint64_t _stream)
+{
+    liquid_rng q = (liquid_rng) malloc(sizeof(struct liquid_rng_s));
+    memset(q, 0, sizeof(struct liquid_rng_s));
+    q->counter_based = 1;
+    q->seed          = _seed;
+    q->stream        = _stream;
+    return q;
+}
+
+// copy object including state
+liquid_rng liquid_rng_copy(liquid_rng q_orig)
+{
+    // validate input
+    if (q_orig == NULL)
+        return liquid_error_config("liquid_rng_copy(), object cannot be NULL");
+
+    return (liquid_rng) liquid_malloc_copy(q_orig, 1, sizeof(struct liquid_rng_s));
+}
+
+// destroy object
+int liquid_rng_destroy(liquid_rng _q)
+{
+    if (_q == NULL)
+        return liquid_error(LIQUID_EIOBJ,"liquid_rng_destroy(), object is null");
+    free(_q);
+    return LIQUID_OK;
+}
+
+// print object
+int liquid_rng_print(liquid_rng _q)
+{
+    liquid_rng q = liquid_rng_resolve(_q);
+    if (q->counter_based) {
+        printf("<liquid.rng, type=\"counter\", seed=0x%.16llx, stream=%llu, offset=%llu>\n",
+            (unsigned long long)q->seed, (unsigned long long)q->stream,
+            (unsigned long long)q->offset);
+        return LIQUID_OK;
+    }
+    printf("<liquid.rng, state=[0x%.16llx 0x%.16llx 0x%.16llx 0x%.16llx]>\n",
+        (unsigned long long)q->s[0], (unsigned long long)q->s[1],
+        (unsigned long long)q->s[2], (unsigned long long)q->s[3]);
+    return LIQUID_OK;
+}
+
+// seed generator, expanding the seed into the full state
+int liquid_rng_seed(liquid_rng _q,
+                    uint64_t   _seed)
+{
+    liquid_rng q = liquid_rng_resolve(_q);
+    if (q->counter_based) {
+        q->seed   = _seed;
+        q->offset = 0;
+        return LIQUID_OK;
+    }
+    uint64_t x = _seed;
+    unsigned int i;
+    for (i=0; i<4; i++)
+        q->s[i] = liquid_rng_splitmix64(&x);
+    return LIQUID_OK;
+}
+
+// advance state by 2^128 draws
+int liquid_rng_jump(liquid_rng _q)
+{
+    static const uint64_t jump[4] = {
+        0x180ec6d33cfd0abaULL, 0xd5a61266f0c9392cULL,
+        0xa9582618e03fc9aaULL, 0x39abdc4529b1661cULL};
+
+    liquid_rng q = liquid_rng_resolve(_q);
+    if (q->counter_based) {
+        // move to start of next stream
+        q->stream++;
+        q->offset = 0;
+        return LIQUID_OK;
+    }
+    uint64_t s[4] = {0, 0, 0, 0};
+    unsigned int i, b;
+    for (i=0; i<4; i++) {
+        for (b=0; b<64; b++) {
+            if (jump[i] & (1ULL << b)) {
+                s[0] ^= q->s[0];
+                s[1] ^= q->s[1];
+                s[2] ^= q->s[2];
+                s[3] ^= q->s[3];
+            }
+            liquid_rng_next(q);
+        }
+    }
+    memmove(q->s, s, sizeof(s));
+    return LIQUID_OK;
+}
+
+// set stream of counter-based generator, resetting offset to zero
+int liquid_rng_set_stream(liquid_rng _q,
+                          uint64_t   _stream)
+{
+    liquid_rng q = liquid_rng_resolve(_q);
+    if (!q->counter_based)
+        return liquid_error(LIQUID_EICONFIG,"liquid_rng_set_stream(), generator is not counter-based");
+    q->stream = _stream;
+    q->offset = 0;
+    return LIQUID_OK;
+}
+
+// get stream of counter-based generator
+uint64_t liquid_rng_get_stream(liquid_rng _q)
+{
+    liquid_rng q = liquid_rng_resolve(_q);
+    if (!q->counter_based) {
+        liquid_error(LIQUID_EICONFIG,"liquid_rng_get_stream(), generator is not counter-based");
+        return 0;
+    }
+    return q->stream;
+}
+
+// set offset (index of next 64-bit output) of counter-based generator
+int liquid_rng_set_offset(liquid_rng _q,
+                          uint64_t   _offset)
+{
+    liquid_rng q = liquid_rng_resolve(_q);
+    if (!q->counter_based)
+        return liquid_error(LIQUID_EICONFIG,"liquid_rng_set_offset(), generator is not counter-based");
+    q->offset = _offset;
+
+    // refill buffer if offset lies in middle of a block
+    if (q->offset & 1)
+        liquid_rng_philox(q->seed, q->stream, q->offset >> 1, q->buf);
+    return LIQUID_OK;
+}
+
+// get offset (index of next 64-bit output) of counter-based generator
+uint64_t liquid_rng_get_offset(liquid_rng _q)
+{
+    liquid_rng q = liquid_rng_resolve(_q);
+    if (!q->counter_based) {
+        liquid_error(LIQUID_EICONFIG,"liquid_rng_get_offset(), generator is not counter-based");
+        return 0;
+    }
+    return q->offset;
+}
+
+// skip ahead by _n 64-bit outputs; constant time for counter-based
+// generators, otherwise the outputs are drawn and discarded
+int liquid_rng_skip(liquid_rng _q,
+                    uint64_t   _n)
+{
+    liquid_rng q = liquid_rng_resolve(_q);
+    if (q->counter_based)
+        return liquid_rng_set_offset(q, q->offset + _n);
+    uint64_t i;
+    for (i=0; i<_n; i++)
+        liquid_rng_next(q);
+    return LIQUID_OK;
+}
+
+// generate 64 uniformly-distributed random bits
+uint64_t liquid_rng_uint64(liquid_rng _q)
+{
+    return liquid_rng_next(liquid_rng_resolve(_q));
+}
+
+// uniform random number in [0,1) from the upper 24 bits
+float liquid_rng_randf(liquid_rng _q)
+{
+    return (float)(liquid_rng_uint64(_q) >> 40) * 0x1.0p-24f;
+}
+
+// Gauss random number N(0,1); a single draw supplies both uniform
+// variables, the first in (0,1] so that its logarithm is finite
+float liquid_rng_randnf(liquid_rng _q)
+{
+    uint64_t r  = liquid_rng_uint64(_q);
+    float    u1 = (float)((r >> 40) + 1) * 0x1.0p-24f;
+    float    u2 = (float)((r >> 16) & 0xffffff) * 0x1.0p-24f;
+    return sqrtf(-2*logf(u1)) * sinf(2*M_PI*u2);
+}
+
+// add Gauss noise with standard deviation _nstd
+void liquid_rng_awgn(liquid_rng _q,
+                     float *    _x,
+                     float      _nstd)
+{
+    *_x += liquid_rng_randnf(_q)*_nstd;
+}
+
+// complex Gauss random number with E{|y|^2} = 2
+void liquid_rng_crandnf(liquid_rng      _q,
+                        float complex * _y)
+{
+    uint64_t r  = liquid_rng_uint64(_q);
+    float    u1 = (float)((r >> 40) + 1) * 0x1.0p-24f;
+    float    u2 = (float)((r >> 16) & 0xffffff) * 0x1.0p-24f;
+    float    a  = sqrtf(-2*logf(u1));
+    *_y = a*cosf(2*M_PI*u2) + _Complex_I*a*sinf(2*M_PI*u2);
+}
+
+// add complex Gauss noise with standard deviation _nstd
+void liquid_rng_cawgn(liquid_rng      _q,
+                      float complex * _x,
+                      float           _nstd)
+{
+    float complex y;
+    liquid_rng_crandnf(_q, &y);
+    *_x += y*_nstd*0.707106781186547f;
+}
+
+// seed the calling thread's default state
+int liquid_rng_default_seed(uint64_t _seed)
+{
+    liquid_rng_resolve(NULL);
+    return liquid_rng_seed(&liquid_rng_thread_state, _seed);
+}
+
+// calling thread's default generator
+liquid_rng liquid_rng_default(void)
+{
+    return liquid_rng_resolve(NULL);
+}
+
+// compute ziggurat tables if not already done
+static void liquid_rng_zig_setup(void)
+{
+    if (liquid_atomic_load_acquire(&liquid_rng_zig_init))
+        return;
+
+    liquid_spinlock_acquire(&liquid_rng_zig_lock);
+    if (!liquid_rng_zig_init) {
+        const double m = 2147483648.0;      // 2^31
+        double dn = 3.442619855899;         // start of right tail
+        double tn = dn;
+        double vn = 9.91256303526217e-3;    // area of each layer
+        double q  = vn / exp(-0.5*dn*dn);
+        liquid_rng_zig_k[0] = (uint32_t)((dn/q)*m);
+        liquid_rng_zig_k[1] = 0;
+        liquid_rng_zig_w[0] = (float)(q/m);
+        liquid_rng_zig_w[LIQUID_RNG_ZIG_LAYERS-1] = (float)(dn/m);
+        liquid_rng_zig_f[0] = 1.0f;
+        liquid_rng_zig_f[LIQUID_RNG_ZIG_LAYERS-1] = (float)exp(-0.5*dn*dn);
+        int i;
+        for (i=LIQUID_RNG_ZIG_LAYERS-2; i>=1; i--) {
+            dn = sqrt(-2*log(vn/dn + exp(-0.5*dn*dn)));
+            liquid_rng_zig_k[i+1] = (uint32_t)((dn/tn)*m);
+            tn = dn;
+            liquid_rng_zig_f[i] = (float)exp(-0.5*dn*dn);
+            liquid_rng_zig_w[i] = (float)(dn/m);
+        }
+        liquid_atomic_store_release(&liquid_rng_zig_init, 1);
+    }
+    liquid_spinlock_release(&liquid_rng_zig_lock);
+}
+
+// draw N(0,1) sample with ziggurat method (tables must be set up)
+static float liquid_rng_zig(liquid_rng _q)
+{
+    while (1) {
+        uint64_t     r  = liquid_rng_next(_q);
+        unsigned int iz = r & (LIQUID_RNG_ZIG_LAYERS-1);
+        int32_t      hz = (int32_t)(r >> 32);
+        uint32_t     uz = hz < 0 ? (uint32_t)0 - (uint32_t)hz : (uint32_t)hz;
+        float        x  = (float)hz * liquid_rng_zig_w[iz];
+
+        // inside rectangle: accept immediately
+        if (uz < liquid_rng_zig_k[iz])
+            return x;
+
+        // base layer: sample from tail beyond r
+        if (iz == 0) {
+            const float rt = 3.442620f;
+            float xt, yt;
+            do {
+                xt = -logf(1.0f - liquid_rng_randf(_q)) / rt;
+                yt = -logf(1.0f - liquid_rng_randf(_q));
+            } while (yt + yt < xt*xt);
+            return hz > 0 ? rt + xt : -rt - xt;
+        }
+
+        // wedge: accept with probability under the pdf
+        float f0 = liquid_rng_zig_f[iz];
+        float f1 = liquid_rng_zig_f[iz-1];
+        if (f0 + liquid_rng_randf(_q)*(f1 - f0) < expf(-0.5f*x*x))
+            return x;
+    }
+}
+
+// generate block of uniform random numbers in [0,1), two per draw
+int liquid_rng_randf_block(liquid_rng   _q,
+                           float *      _y,
+                           unsigned int _n)
+{
+    liquid_rng q = liquid_rng_resolve(_q);
+    unsigned int i;
+    for (i=0; i+1<_n; i+=2) {
+        uint64_t r = liquid_rng_next(q);
+        _y[i  ] = (float)(r >> 40)              * 0x1.0p-24f;
+        _y[i+1] = (float)((r >> 16) & 0xffffff) * 0x1.0p-24f;
+    }
+    if (i < _n)
+        _y[i] = liquid_rng_randf(q);
+    return LIQUID_OK;
+}
+
+// generate block of Gauss random numbers N(0,1)
+int liquid_rng_randnf_block(liquid_rng   _q,
+                            float *      _y,
+                            unsigned int _n)
+{
+    liquid_rng q = liquid_rng_resolve(_q);
+    liquid_rng_zig_setup();
+    unsigned int i;
+    for (i=0; i<_n; i++)
+        _y[i] = liquid_rng_zig(q);
+    return LIQUID_OK;
+}
+
+// generate block of complex Gauss random numbers, E{|y|^2} = 2
+int liquid_rng_crandnf_block(liquid_rng      _q,
+                             float complex * _y,
+                             unsigned int    _n)
+{
+    return liquid_rng_randnf_block(_q, (float*)_y, 2*_n);
+}
+
+// add Gauss noise with standard deviation _nstd to block
+int liquid_rng_awgn_block(liquid_rng   _q,
+                          float *      _x,
+                          unsigned int _n,
+                          float        _nstd)
+{
+    liquid_rng q = liquid_rng_resolve(_q);
+    liquid_rng_zig_setup();
+    unsigned int i;
+    for (i=0; i<_n; i++)
+        _x[i] += liquid_rng_zig(q) * _nstd;
+    return LIQUID_OK;
+}
+
+// add complex Gauss noise with standard deviation _nstd to block
+int liquid_rng_cawgn_block(liquid_rng      _q,
+                           float complex * _x,
+                           unsigned int    _n,
+                           float           _nstd)
+{
+    return liquid_rng_awgn_block(_q, (float*)_x, 2*_n, _nstd*0.707106781186547f);
+}
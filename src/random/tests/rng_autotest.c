@@ -0,0 +1,329 @@
+/*
+ * Copyright (c) 2007 - 2025 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <math.h>
+#include <complex.h>
+#include "autotest/autotest.h"
+#include "liquid.h"
+
+// check output against reference xoshiro256** with splitmix64 seeding
+void autotest_rng_reference()
+{
+    uint64_t ref[4] = {
+        0xbe6a36374160d49bULL, 0x214aaa0637a688c6ULL,
+        0xf69d16de9954d388ULL, 0x0c60048c4e96e033ULL};
+    liquid_rng q = liquid_rng_create(12345);
+    unsigned int i;
+    for (i=0; i<4; i++)
+        CONTEND_EQUALITY(liquid_rng_uint64(q), ref[i]);
+
+    // re-seeding restarts sequence
+    liquid_rng_seed(q, 12345);
+    CONTEND_EQUALITY(liquid_rng_uint64(q), ref[0]);
+    liquid_rng_destroy(q);
+}
+
+// copies continue the same sequence; jumps give a different one
+void autotest_rng_copy_jump()
+{
+    liquid_rng q0 = liquid_rng_create(7);
+    liquid_rng_uint64(q0);
+    liquid_rng q1 = liquid_rng_copy(q0);
+    liquid_rng q2 = liquid_rng_copy(q0);
+    liquid_rng_jump(q2);
+
+    unsigned int i, num_equal = 0;
+    for (i=0; i<100; i++) {
+        uint64_t v0 = liquid_rng_uint64(q0);
+        CONTEND_EQUALITY(liquid_rng_uint64(q1), v0);
+        num_equal += liquid_rng_uint64(q2) == v0;
+    }
+    CONTEND_EQUALITY(num_equal, 0);
+
+    liquid_rng_destroy(q0);
+    liquid_rng_destroy(q1);
+    liquid_rng_destroy(q2);
+}
+
+// default thread state follows the same sequence as an object
+void autotest_rng_default()
+{
+    liquid_rng q = liquid_rng_create(99);
+    liquid_rng_default_seed(99);
+    unsigned int i;
+    for (i=0; i<100; i++)
+        CONTEND_EQUALITY(liquid_rng_uint64(NULL), liquid_rng_uint64(q));
+    liquid_rng_destroy(q);
+}
+
+// moments of uniform and Gauss distributions
+void autotest_rng_moments()
+{
+    liquid_rng q = liquid_rng_create(1);
+    unsigned int i, n = 200000;
+    float u_min = 1.0f, u_max = 0.0f;
+    float u1 = 0.0f, u2 = 0.0f;
+    float g1 = 0.0f, g2 = 0.0f;
+    float c1 = 0.0f, c2 = 0.0f;
+    for (i=0; i<n; i++) {
+        float u = liquid_rng_randf(q);
+        u_min = u < u_min ? u : u_min;
+        u_max = u > u_max ? u : u_max;
+        u1 += u;
+        u2 += u*u;
+
+        float g = liquid_rng_randnf(q);
+        g1 += g;
+        g2 += g*g;
+
+        float complex c = 0.0f;
+        liquid_rng_cawgn(q, &c, 0.5f);
+        c1 += crealf(c) + cimagf(c);
+        c2 += crealf(c*conjf(c));
+    }
+    CONTEND_TRUE(u_min >= 0.0f);
+    CONTEND_LESS_THAN(u_max, 1.0f);
+    CONTEND_DELTA(u1/n,        0.5f,        0.01f);
+    CONTEND_DELTA(u2/n,        1.0f/3.0f,   0.01f);
+    CONTEND_DELTA(g1/n,        0.0f,        0.01f);
+    CONTEND_DELTA(g2/n,        1.0f,        0.02f);
+    CONTEND_DELTA(c1/n,        0.0f,        0.01f);
+    CONTEND_DELTA(c2/n,        0.25f,       0.01f);
+    liquid_rng_destroy(q);
+}
+
+void autotest_rng_config()
+{
+#if LIQUID_STRICT_EXIT
+    AUTOTEST_WARN("skipping rng config test with strict exit enabled\n");
+    return;
+#endif
+#if !LIQUID_SUPPRESS_ERROR_OUTPUT
+    fprintf(stderr,"warning: ignore potential errors here; checking for invalid configurations\n");
+#endif
+    CONTEND_ISNULL(liquid_rng_copy(NULL));
+    CONTEND_INEQUALITY(LIQUID_OK, liquid_rng_destroy(NULL));
+
+    liquid_rng q = liquid_rng_create(0);
+    CONTEND_EQUALITY(LIQUID_OK, liquid_rng_print(q));
+    liquid_rng_destroy(q);
+}
+
+// moments and tail of block methods
+void autotest_rng_block_moments()
+{
+    unsigned int i, n = 400001;
+    float * u = (float*) malloc(n*sizeof(float));
+    float * g = (float*) malloc(n*sizeof(float));
+    float complex * c = (float complex*) malloc(n*sizeof(float complex));
+    liquid_rng q = liquid_rng_create(3);
+    liquid_rng_randf_block (q, u, n);
+    liquid_rng_randnf_block(q, g, n);
+    for (i=0; i<n; i++) c[i] = 1.0f;
+    liquid_rng_cawgn_block (q, c, n, 0.5f);
+
+    float u_min = 1.0f, u_max = 0.0f, u1 = 0.0f, u2 = 0.0f;
+    float g1 = 0.0f, g2 = 0.0f, g4 = 0.0f, c1 = 0.0f, c2 = 0.0f;
+    unsigned int num_tail = 0;
+    for (i=0; i<n; i++) {
+        u_min = u[i] < u_min ? u[i] : u_min;
+        u_max = u[i] > u_max ? u[i] : u_max;
+        u1 += u[i];
+        u2 += u[i]*u[i];
+        g1 += g[i];
+        g2 += g[i]*g[i];
+        g4 += g[i]*g[i]*g[i]*g[i];
+        num_tail += fabsf(g[i]) > 3.0f;
+        float complex e = c[i] - 1.0f;
+        c1 += crealf(e) + cimagf(e);
+        c2 += crealf(e*conjf(e));
+    }
+    CONTEND_TRUE(u_min >= 0.0f);
+    CONTEND_LESS_THAN(u_max, 1.0f);
+    CONTEND_DELTA(u1/n, 0.5f,      0.01f);
+    CONTEND_DELTA(u2/n, 1.0f/3.0f, 0.01f);
+    CONTEND_DELTA(g1/n, 0.0f,      0.01f);
+    CONTEND_DELTA(g2/n, 1.0f,      0.01f);
+    CONTEND_DELTA(g4/n, 3.0f,      0.1f);
+    // P(|x| > 3) = 2.70e-3
+    CONTEND_DELTA((float)num_tail/n, 2.70e-3f, 0.4e-3f);
+    CONTEND_DELTA(c1/n, 0.0f,      0.01f);
+    CONTEND_DELTA(c2/n, 0.25f,     0.01f);
+
+    liquid_rng_destroy(q);
+    free(u);
+    free(g);
+    free(c);
+}
+
+// block methods without object use calling thread's default state
+void autotest_rng_block_default()
+{
+    float complex y0[64], y1[64];
+    liquid_rng q = liquid_rng_create(5);
+    liquid_rng_default_seed(5);
+    crandnf_block(y0, 64);
+    liquid_rng_crandnf_block(q, y1, 64);
+    CONTEND_SAME_DATA(y0, y1, sizeof(y0));
+    liquid_rng_destroy(q);
+}
+
+// Philox4x32-10 known-answer test (Salmon et al., 2011): the first two
+// outputs of stream zero with zero seed are the counter-zero reference block
+void autotest_rng_counter_kat()
+{
+    liquid_rng q = liquid_rng_create_counter(0, 0);
+    CONTEND_EQUALITY(liquid_rng_uint64(q), 0xe169c58d6627e8d5ULL);
+    CONTEND_EQUALITY(liquid_rng_uint64(q), 0x9b00dbd8bc57ac4cULL);
+    liquid_rng_destroy(q);
+
+    // seed and stream form key and upper half of counter
+    q = liquid_rng_create_counter(12345, 7);
+    CONTEND_EQUALITY(liquid_rng_uint64(q), 0x8f703033e6f940bbULL);
+    CONTEND_EQUALITY(liquid_rng_uint64(q), 0x5e9ad4d4680c7f25ULL);
+    CONTEND_EQUALITY(liquid_rng_uint64(q), 0xae052b7ea1b975c9ULL);
+    CONTEND_EQUALITY(liquid_rng_uint64(q), 0x35f25bb1ef9fd9d3ULL);
+    CONTEND_EQUALITY(liquid_rng_get_offset(q), 4);
+    liquid_rng_destroy(q);
+}
+
+// any offset is reachable directly and matches sequential draws
+void autotest_rng_counter_offset()
+{
+    unsigned int i, n = 101;
+    uint64_t v[101];
+    liquid_rng q = liquid_rng_create_counter(77, 3);
+    for (i=0; i<n; i++)
+        v[i] = liquid_rng_uint64(q);
+
+    // set offset directly, both even and odd
+    for (i=0; i<n; i+=7) {
+        liquid_rng_set_offset(q, i);
+        CONTEND_EQUALITY(liquid_rng_uint64(q), v[i]);
+        if (i+1 < n)
+            CONTEND_EQUALITY(liquid_rng_uint64(q), v[i+1]);
+    }
+
+    // skip ahead relative to current offset
+    liquid_rng_set_offset(q, 0);
+    liquid_rng_skip(q, 13);
+    CONTEND_EQUALITY(liquid_rng_uint64(q), v[13]);
+    liquid_rng_skip(q, 50);
+    CONTEND_EQUALITY(liquid_rng_uint64(q), v[64]);
+
+    // skip on xoshiro generator draws and discards
+    liquid_rng r0 = liquid_rng_create(9);
+    liquid_rng r1 = liquid_rng_create(9);
+    for (i=0; i<5; i++)
+        liquid_rng_uint64(r0);
+    liquid_rng_skip(r1, 5);
+    CONTEND_EQUALITY(liquid_rng_uint64(r0), liquid_rng_uint64(r1));
+
+    liquid_rng_destroy(q);
+    liquid_rng_destroy(r0);
+    liquid_rng_destroy(r1);
+}
+
+// streams and seeds give distinct sequences; seed() and jump() restart
+void autotest_rng_counter_streams()
+{
+    liquid_rng q0 = liquid_rng_create_counter(5, 0);
+    liquid_rng q1 = liquid_rng_create_counter(5, 1);
+    liquid_rng q2 = liquid_rng_create_counter(6, 0);
+    uint64_t v0 = liquid_rng_uint64(q0);
+    CONTEND_INEQUALITY(v0, liquid_rng_uint64(q1));
+    CONTEND_INEQUALITY(v0, liquid_rng_uint64(q2));
+
+    // jump moves to start of next stream
+    liquid_rng_jump(q0);
+    CONTEND_EQUALITY(liquid_rng_get_stream(q0), 1);
+    CONTEND_EQUALITY(liquid_rng_get_offset(q0), 0);
+    liquid_rng_set_offset(q1, 0);
+    CONTEND_EQUALITY(liquid_rng_uint64(q0), liquid_rng_uint64(q1));
+
+    // re-seeding keeps stream and resets offset
+    liquid_rng_seed(q2, 5);
+    liquid_rng_set_stream(q2, 1);
+    liquid_rng_set_offset(q1, 0);
+    CONTEND_EQUALITY(liquid_rng_uint64(q2), liquid_rng_uint64(q1));
+
+    // copy retains position
+    liquid_rng q3 = liquid_rng_copy(q2);
+    CONTEND_EQUALITY(liquid_rng_uint64(q2), liquid_rng_uint64(q3));
+    CONTEND_EQUALITY(liquid_rng_uint64(q2), liquid_rng_uint64(q3));
+
+    liquid_rng_destroy(q0);
+    liquid_rng_destroy(q1);
+    liquid_rng_destroy(q2);
+    liquid_rng_destroy(q3);
+}
+
+// distributions drawn from generator are reproducible and have the
+// expected mean
+void autotest_rng_distributions()
+{
+    unsigned int i, n = 100000;
+    liquid_rng q = liquid_rng_create_counter(11, 0);
+    float m_exp = 0, m_weib = 0, m_gamma = 0, m_nakm = 0, m_rice = 0;
+    for (i=0; i<n; i++) {
+        m_exp   += liquid_rng_randexpf  (q, 2.0f);
+        m_weib  += liquid_rng_randweibf (q, 1.0f, 2.0f, 0.5f);
+        m_gamma += liquid_rng_randgammaf(q, 2.5f, 1.5f);
+        m_nakm  += liquid_rng_randnakmf (q, 1.0f, 2.0f);
+        float r  = liquid_rng_randricekf(q, 2.0f, 1.0f);
+        m_rice  += r*r;
+    }
+    CONTEND_DELTA(m_exp  /n, 0.5f,  0.01f);  // 1/lambda
+    CONTEND_DELTA(m_weib /n, 2.5f,  0.05f);  // gamma + beta*Gamma(1+1/alpha)
+    CONTEND_DELTA(m_gamma/n, 3.75f, 0.05f);  // alpha*beta
+    CONTEND_DELTA(m_nakm /n, 1.2533f, 0.02f); // sqrt(pi/2), m=1, omega=2
+    CONTEND_DELTA(m_rice /n, 1.0f,  0.02f);  // E{x^2} = omega
+
+    // same (seed, stream, offset) gives same values
+    liquid_rng_set_offset(q, 1000);
+    float g0 = liquid_rng_randgammaf(q, 0.7f, 1.0f);
+    float r0 = liquid_rng_randricekf(q, 3.0f, 1.0f);
+    liquid_rng_set_offset(q, 1000);
+    CONTEND_EQUALITY(liquid_rng_randgammaf(q, 0.7f, 1.0f), g0);
+    CONTEND_EQUALITY(liquid_rng_randricekf(q, 3.0f, 1.0f), r0);
+    liquid_rng_destroy(q);
+}
+
+// offset methods require a counter-based generator
+void autotest_rng_counter_config()
+{
+#if LIQUID_STRICT_EXIT
+    AUTOTEST_WARN("skipping rng counter config test with strict exit enabled\n");
+    return;
+#endif
+#if !LIQUID_SUPPRESS_ERROR_OUTPUT
+    fprintf(stderr,"warning: ignore potential errors here; checking for invalid configurations\n");
+#endif
+    liquid_rng q = liquid_rng_create(1);
+    CONTEND_INEQUALITY(liquid_rng_set_offset(q, 4), LIQUID_OK);
+    CONTEND_INEQUALITY(liquid_rng_set_stream(q, 4), LIQUID_OK);
+    CONTEND_EQUALITY  (liquid_rng_get_offset(q), 0);
+    CONTEND_EQUALITY  (liquid_rng_get_stream(q), 0);
+    liquid_rng_destroy(q);
+}
@@ -0,0 +1,254 @@
+/*
+ * Copyright (c) 2007 - 2025 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// Shared read-only object registry
+//
+// Objects whose contents never change after creation (e.g. the aligned
+// coefficient arrays held by dotprod objects) are allocated with a small
+// hidden header holding their reference count and are registered in a
+// hash table keyed on the data they were built from. Only the hash is
+// stored; candidates are confirmed by comparing the key against the
+// object's own contents through a type-specific match callback, so no
+// copy of the key is kept. Creating another object from the same key
+// returns the existing one with its reference count incremented.
+//
+// Each hash bucket has its own lock which also guards the reference counts
+// of the objects in it, so a lookup can never race the final release of an
+// object while unrelated objects are created and destroyed concurrently.
+//
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "liquid.internal.h"
+
+#define LIQUID_SHARED_NUM_BUCKETS (256)
+
+// hidden object header
+struct liquid_shared_s {
+    liquid_shared_match     match;  // match callback (also identifies type)
+    uint32_t                hash;   // hash of key
+    int                     rev;    // key reversal flag
+    unsigned int            size;   // object size [bytes]
+    unsigned int            refs;   // reference count
+    int                     linked; // object is in registry
+    struct liquid_shared_s * next;  // next object in bucket
+};
+
+// header size, rounded to keep object memory aligned
+#define LIQUID_SHARED_HEADER_SIZE ((sizeof(struct liquid_shared_s) + 31) & ~(size_t)31)
+
+// get header from object pointer and vice versa
+#define LIQUID_SHARED_HEADER(_obj) \
+    ((struct liquid_shared_s *)((unsigned char *)(_obj) - LIQUID_SHARED_HEADER_SIZE))
+#define LIQUID_SHARED_OBJECT(_hdr) \
+    ((void *)((unsigned char *)(_hdr) + LIQUID_SHARED_HEADER_SIZE))
+
+// global registry state
+static struct {
+    char                     locks  [LIQUID_SHARED_NUM_BUCKETS];
+    struct liquid_shared_s * buckets[LIQUID_SHARED_NUM_BUCKETS];
+} liquid_shared = {{0}, {NULL}};
+
+// remove object from its bucket (bucket lock must be held)
+static void liquid_shared_unlink(struct liquid_shared_s * _hdr)
+{
+    struct liquid_shared_s ** p =
+        &liquid_shared.buckets[_hdr->hash % LIQUID_SHARED_NUM_BUCKETS];
+    while (*p != _hdr)
+        p = &(*p)->next;
+    *p = _hdr->next;
+    _hdr->linked = 0;
+}
+
+// match callback for buffers allocated with liquid_shared_malloc_copy()
+static int liquid_shared_match_buffer(const void * _obj,
+                                      const void * _key,
+                                      unsigned int _n,
+                                      int          _rev)
+{
+    return LIQUID_SHARED_HEADER(_obj)->size == _n &&
+           memcmp(_obj, _key, _n) == 0;
+}
+
+// 32-bit FNV-1a hash of key and reversal flag
+uint32_t liquid_shared_hash(const void * _key,
+                            unsigned int _key_len,
+                            int          _rev)
+{
+    const unsigned char * p = (const unsigned char *) _key;
+    uint32_t hash = 2166136261u ^ (_rev ? 1u : 0u);
+    unsigned int i;
+    for (i=0; i<_key_len; i++) {
+        hash ^= p[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+void * liquid_shared_alloc(unsigned int _size)
+{
+    struct liquid_shared_s * hdr =
+        (struct liquid_shared_s *) malloc(LIQUID_SHARED_HEADER_SIZE + _size);
+    if (hdr == NULL)
+        return NULL;
+    hdr->match  = NULL;
+    hdr->hash   = 0;
+    hdr->rev    = 0;
+    hdr->size   = _size;
+    hdr->refs   = 1;
+    hdr->linked = 0;
+    hdr->next   = NULL;
+    return LIQUID_SHARED_OBJECT(hdr);
+}
+
+int liquid_shared_dealloc(void * _obj)
+{
+    if (_obj != NULL)
+        free(LIQUID_SHARED_HEADER(_obj));
+    return LIQUID_OK;
+}
+
+void * liquid_shared_acquire(liquid_shared_match _match,
+                             uint32_t            _hash,
+                             const void *        _key,
+                             unsigned int        _n,
+                             int                 _rev)
+{
+    unsigned int k = _hash % LIQUID_SHARED_NUM_BUCKETS;
+    void * obj = NULL;
+    liquid_spinlock_acquire(&liquid_shared.locks[k]);
+    struct liquid_shared_s * e;
+    for (e = liquid_shared.buckets[k]; e != NULL; e = e->next) {
+        if (e->hash == _hash && e->match == _match && e->rev == _rev &&
+            _match(LIQUID_SHARED_OBJECT(e), _key, _n, _rev))
+        {
+            e->refs++;
+            obj = LIQUID_SHARED_OBJECT(e);
+            break;
+        }
+    }
+    liquid_spinlock_release(&liquid_shared.locks[k]);
+    return obj;
+}
+
+int liquid_shared_insert(void *              _obj,
+                         liquid_shared_match _match,
+                         uint32_t            _hash,
+                         int                 _rev)
+{
+    struct liquid_shared_s * hdr = LIQUID_SHARED_HEADER(_obj);
+    if (hdr->linked)
+        return liquid_error(LIQUID_EICONFIG,"liquid_shared_insert(), object already registered");
+
+    unsigned int k = _hash % LIQUID_SHARED_NUM_BUCKETS;
+    liquid_spinlock_acquire(&liquid_shared.locks[k]);
+    hdr->match  = _match;
+    hdr->hash   = _hash;
+    hdr->rev    = _rev;
+    hdr->linked = 1;
+    hdr->next   = liquid_shared.buckets[k];
+    liquid_shared.buckets[k] = hdr;
+    liquid_spinlock_release(&liquid_shared.locks[k]);
+    return LIQUID_OK;
+}
+
+int liquid_shared_retain(void * _obj)
+{
+    struct liquid_shared_s * hdr = LIQUID_SHARED_HEADER(_obj);
+    unsigned int k = hdr->hash % LIQUID_SHARED_NUM_BUCKETS;
+    liquid_spinlock_acquire(&liquid_shared.locks[k]);
+    hdr->refs++;
+    liquid_spinlock_release(&liquid_shared.locks[k]);
+    return LIQUID_OK;
+}
+
+unsigned int liquid_shared_release(void * _obj)
+{
+    struct liquid_shared_s * hdr = LIQUID_SHARED_HEADER(_obj);
+    unsigned int k = hdr->hash % LIQUID_SHARED_NUM_BUCKETS;
+    liquid_spinlock_acquire(&liquid_shared.locks[k]);
+    unsigned int refs = --hdr->refs;
+    if (refs == 0 && hdr->linked)
+        liquid_shared_unlink(hdr);
+    liquid_spinlock_release(&liquid_shared.locks[k]);
+    return refs;
+}
+
+int liquid_shared_detach(void * _obj)
+{
+    struct liquid_shared_s * hdr = LIQUID_SHARED_HEADER(_obj);
+    unsigned int k = hdr->hash % LIQUID_SHARED_NUM_BUCKETS;
+    liquid_spinlock_acquire(&liquid_shared.locks[k]);
+    int unshared = hdr->refs == 1;
+    if (unshared && hdr->linked)
+        liquid_shared_unlink(hdr);
+    liquid_spinlock_release(&liquid_shared.locks[k]);
+    return unshared;
+}
+
+void * liquid_shared_malloc_copy(const void * _orig,
+                                 unsigned int _num,
+                                 unsigned int _size)
+{
+    return liquid_shared_realloc_copy(NULL, _orig, _num, _size);
+}
+
+void * liquid_shared_realloc_copy(void *       _p,
+                                  const void * _orig,
+                                  unsigned int _num,
+                                  unsigned int _size)
+{
+    // share existing buffer with identical contents
+    unsigned int n = _num * _size;
+    uint32_t hash = liquid_shared_hash(_orig, n, 0);
+    void * p = liquid_shared_acquire(liquid_shared_match_buffer, hash, _orig, n, 0);
+    if (p != NULL) {
+        liquid_shared_free(_p);
+        return p;
+    }
+
+    if (_p != NULL && liquid_shared_detach(_p)) {
+        // sole owner of old buffer: re-use its memory in place
+        struct liquid_shared_s * hdr = LIQUID_SHARED_HEADER(_p);
+        if (hdr->size != n) {
+            hdr = (struct liquid_shared_s *) realloc(hdr, LIQUID_SHARED_HEADER_SIZE + n);
+            hdr->size = n;
+        }
+        p = LIQUID_SHARED_OBJECT(hdr);
+    } else {
+        // old buffer (if any) is shared with other users; leave it intact
+        liquid_shared_free(_p);
+        p = liquid_shared_alloc(n);
+    }
+    memmove(p, _orig, n);
+    liquid_shared_insert(p, liquid_shared_match_buffer, hash, 0);
+    return p;
+}
+
+int liquid_shared_free(void * _p)
+{
+    if (_p != NULL && liquid_shared_release(_p) == 0)
+        liquid_shared_dealloc(_p);
+    return LIQUID_OK;
+}